@@ -1,73 +1,89 @@
-// #ifndef BVH_H
-// #define BVH_H
-
-// #include "../core/Object3D.h"      // Core::Object3D
-// #include "../geometry/AABB.h"       // Geometry::AABB
-// #include "../math/Vector3.h"        // Math::Vector3
-// #include <vector>
-// #include <memory>
-// #include <algorithm>
-
-// namespace Collision {
-
-// // BVH 노드 클래스
-// class BVHNode {
-// public:
-//     AABB aabb;                      // 노드가 감싸는 AABB
-//     std::shared_ptr<BVHNode> left;            // 왼쪽 자식
-//     std::shared_ptr<BVHNode> right;           // 오른쪽 자식
-//     Core::Object3D* object;                   // 리프 노드일 때 해당 객체 (없으면 nullptr)
-
-//     BVHNode() : object(nullptr) {}
-
-//     bool isLeaf() const {
-//         return !left && !right;
-//     }
-// };
-
-// // BVH 클래스 (충돌 탐색 구조)
-// class BVH {
-// private:
-//     std::shared_ptr<BVHNode> root;           // BVH 루트 노드
-//     std::vector<Core::Object3D*> objects;      // 관리하는 객체들
-
-//     // 재귀적으로 노드 생성 (start ~ end 범위의 객체들을 이용)
-//     std::shared_ptr<BVHNode> buildNode(std::vector<Core::Object3D*>& nodeObjects, int depth);
-
-//     // 두 노드 간 충돌 가능성이 있는 쌍을 찾음
-//     void findCollisions(std::shared_ptr<BVHNode> nodeA, std::shared_ptr<BVHNode> nodeB,
-//         std::vector<std::pair<Core::Object3D*, Core::Object3D*>>& collisionPairs);
-
-// public:
-//     BVH() : root(nullptr) {}
-
-//     // 객체 추가 시 BVH 재구축
-//     void addObject(Core::Object3D* object) {
-//         objects.push_back(object);
-//         rebuild();
-//     }
-
-//     // 객체 제거 시 BVH 재구축
-//     void removeObject(Core::Object3D* object) {
-//         auto it = std::find(objects.begin(), objects.end(), object);
-//         if (it != objects.end()) {
-//             objects.erase(it);
-//             rebuild();
-//         }
-//     }
-
-//     // 객체 업데이트 시(변경된 AABB 등을 반영) BVH 재구축
-//     void updateObject(Core::Object3D* object) {
-//         rebuild();
-//     }
-
-//     // BVH 재구축 (객체들의 AABB 업데이트 후)
-//     void rebuild();
-
-//     // 충돌 가능성 있는 객체 쌍들을 반환
-//     std::vector<std::pair<Core::Object3D*, Core::Object3D*>> findCollisionPairs();
-// };
-
-// } // namespace Collision
-
-// #endif // BVH_H
+#ifndef BVH_H
+#define BVH_H
+
+#include "../core/Object3D.h"      // Object3D
+#include "../geometry/AABB.h"       // AABB
+#include "../math/Vector3.h"        // Vector3
+#include <vector>
+#include <unordered_map>
+#include <utility>
+
+namespace Collision {
+
+// BVH 노드 (하나의 연속 배열 안에서 인덱스로 서로를 참조)
+struct BVHNode {
+    AABB aabb;                      // 노드가 감싸는 AABB (리프는 여유를 둔 fat AABB)
+    Object3D* object;               // 리프 노드일 때 해당 객체 (없으면 nullptr)
+    int parent;                     // 부모 노드 (빈 노드일 때는 다음 빈 노드)
+    int left;                       // 왼쪽 자식
+    int right;                      // 오른쪽 자식
+    int height;                     // 리프 = 0, 빈 노드 = -1
+
+    BVHNode() : object(nullptr), parent(-1), left(-1), right(-1), height(-1) {}
+
+    bool isLeaf() const {
+        return left == -1;
+    }
+};
+
+// 동적 AABB 트리 (충돌 탐색 구조)
+// 리프는 fat AABB를 저장하므로 작은 움직임에는 트리를 건드리지 않고,
+// 객체가 fat AABB를 벗어날 때만 해당 리프를 O(log n)으로 제거/재삽입한다.
+class BVH {
+public:
+    static const int NULL_NODE = -1;
+
+    explicit BVH(float fatMargin = 0.1f);
+
+    // 객체 추가/제거 (O(log n), 회전으로 균형 유지)
+    void addObject(Object3D* object);
+    void removeObject(Object3D* object);
+
+    // 객체의 월드 AABB가 fat AABB를 벗어났으면 리프를 다시 삽입 (이동했으면 true)
+    bool updateObject(Object3D* object);
+
+    // 관리 중인 모든 객체 갱신
+    void update();
+
+    void clear();
+
+    // 트리 자기 자신과의 순회로 충돌 가능성 있는 객체 쌍들을 반환
+    void findCollisionPairs(std::vector<std::pair<Object3D*, Object3D*>>& collisionPairs);
+
+    // 주어진 AABB와 겹치는 객체 수집
+    void query(const AABB& aabb, std::vector<Object3D*>& results) const;
+
+    void setFatMargin(float margin) { fatMargin = margin; }
+    float getFatMargin() const { return fatMargin; }
+
+    int getHeight() const { return root == NULL_NODE ? 0 : nodes[root].height; }
+    size_t getObjectCount() const { return objectToLeaf.size(); }
+    const std::vector<BVHNode>& getNodes() const { return nodes; }
+    int getRoot() const { return root; }
+
+private:
+    std::vector<BVHNode> nodes;                     // 노드 배열
+    int root;                                       // 루트 노드 인덱스
+    int freeList;                                   // 빈 노드 목록의 첫 인덱스
+    float fatMargin;                                // 리프 AABB 확장 폭
+    std::unordered_map<Object3D*, int> objectToLeaf;
+
+    // 자기 순회에 사용하는 노드 쌍 스택 (프레임 간 재사용)
+    std::vector<std::pair<int, int>> pairStack;
+
+    int allocateNode();
+    void freeNode(int node);
+
+    void insertLeaf(int leaf);
+    void removeLeaf(int leaf);
+
+    // 조상 노드들의 AABB와 높이를 갱신하며 필요하면 회전
+    void refitAncestors(int node);
+    int balance(int node);
+
+    AABB fatten(const AABB& aabb) const;
+};
+
+} // namespace Collision
+
+#endif // BVH_H
@@ -0,0 +1,128 @@
+#ifndef CONTACT_MANIFOLD_H
+#define CONTACT_MANIFOLD_H
+
+#include "../math/Vector3.h"
+#include "../math/Transform.h"
+#include "../decomposition/ConvexHull.h"
+#include "SAT.h"
+#include "EPA.h"
+#include <vector>
+#include <cstdint>
+
+namespace Collision {
+
+    // 접촉점 하나
+    struct ContactPoint {
+        Vector3 position;       // 두 표면 점의 중간 (월드)
+        Vector3 localA;         // A 표면 위의 점 (검사에 쓴 A 변환의 로컬 좌표)
+        Vector3 localB;         // B 표면 위의 점 (검사에 쓴 B 변환의 로컬 좌표)
+        float depth;            // 법선 방향 침투 깊이
+        uint64_t featureId;     // 접촉을 만든 특징 (makeFeatureId/makeEdgeFeatureId), 프레임 간 같은 점을 찾는 키
+        int lifetime;           // 이 점이 이어진 프레임 수 (새 점이면 0)
+    };
+
+    // 객체 쌍 하나의 접촉 다양체 (최대 4점)
+    // 기준 면(reference face)에 입사 면(incident face)을 잘라 만든 점들과 공통 법선
+    struct ContactManifold {
+        static const int MAX_POINTS = 4;
+
+        Vector3 normal;             // A에서 B로 향하는 단위 법선
+        SATFeature feature;         // 기준 면 쪽 (FACE_A/FACE_B), 변 접촉(EDGES), 특징 정보 없는 단일 점(NONE)
+        int hullA;                  // 접촉을 만든 껍질 쌍 (분해되지 않은 객체는 0)
+        int hullB;
+        ContactPoint points[MAX_POINTS];
+        int pointCount;
+
+        ContactManifold() : feature(SATFeature::NONE), hullA(-1), hullB(-1), pointCount(0) {}
+
+        void clear() { pointCount = 0; }
+
+        // 접촉점들의 평균 위치 (점이 없으면 원점)
+        Vector3 center() const;
+        float maxDepth() const;
+
+        // 새로 만든 fresh로 교체하면서 지난 프레임 점과 대응되는 점의 lifetime을 이어 감
+        // 같은 껍질 쌍/기준 쪽이면 특징 ID로, 아니면 A 로컬 위치가 matchDistance 이내인 점으로 대응
+        void merge(const ContactManifold& fresh, float matchDistance);
+
+        // 면 접촉 특징 ID: [기준 면][입사 면][자른 측면 + 1 (0이면 원래 입사 꼭짓점)][입사 다각형 꼭짓점] 각 16비트
+        // (분해/병합 껍질도 면이 65536개를 넘지 않으므로 서로 다른 특징이 겹치지 않음)
+        static uint64_t makeFeatureId(int referenceFace, int incidentFace, int clipPlane, int incidentVertex) {
+            return (static_cast<uint64_t>(referenceFace & 0xFFFF) << 48) |
+                   (static_cast<uint64_t>(incidentFace & 0xFFFF) << 32) |
+                   (static_cast<uint64_t>(clipPlane & 0xFFFF) << 16) |
+                   static_cast<uint64_t>(incidentVertex & 0xFFFF);
+        }
+
+        // 변 접촉 특징 ID: [A 변][B 변] 각 32비트 (변 번호는 면보다 훨씬 많아질 수 있으므로 그대로 담음)
+        // 특징 ID는 같은 특징 종류(면/변)의 다양체끼리만 비교하므로 면 접촉 ID와 겹쳐도 상관없다.
+        static uint64_t makeEdgeFeatureId(int edgeA, int edgeB) {
+            return (static_cast<uint64_t>(static_cast<uint32_t>(edgeA)) << 32) |
+                   static_cast<uint64_t>(static_cast<uint32_t>(edgeB));
+        }
+    };
+
+    // SAT 또는 EPA 결과에서 접촉 다양체를 만드는 기준 면/입사 면 자르기 (Sutherland-Hodgman)
+    // 기준 면의 측면 평면으로 입사 면 다각형을 자르고 기준 면 아래의 점만 남긴 뒤 4점으로 줄인다.
+    // 다각형 버퍼는 객체에 두고 재사용한다.
+    class ManifoldBuilder {
+    public:
+        ManifoldBuilder() {}
+
+        // SAT 결과 (면 접촉은 자르기, 변 접촉은 두 변의 최근접점 한 점)
+        bool FromSAT(const ConvexHull& shapeA, const Transform& transformA,
+                     const ConvexHull& shapeB, const Transform& transformB,
+                     const SATResult& sat, ContactManifold& manifold);
+
+        // EPA 결과 (법선에 가장 잘 맞는 면을 기준 면으로 골라 자르기, 면 정보가 없으면 EPA 접촉점 한 점)
+        bool FromEPA(const ConvexHull& shapeA, const Transform& transformA,
+                     const ConvexHull& shapeB, const Transform& transformB,
+                     const EPAResult& epa, ContactManifold& manifold);
+
+        // 월드 점 pointA (A 표면), pointB (B 표면) 한 점으로 된 다양체 (특징 정보 없음)
+        static void SinglePoint(const Transform& transformA, const Transform& transformB, const Vector3& normal,
+                                const Vector3& pointA, const Vector3& pointB, float depth, ContactManifold& manifold);
+
+        // 다양체에 월드 점 pointA, pointB 한 점을 더함 (가득 차 있으면 false, 법선과 특징은 그대로)
+        static bool AddPoint(const Transform& transformA, const Transform& transformB,
+                             const Vector3& pointA, const Vector3& pointB, float depth, uint64_t featureId,
+                             ContactManifold& manifold);
+
+        // 두 선분 [p1, q1], [p2, q2]의 최근접점 c1, c2 (Ericson, Real-Time Collision Detection 5.1.9)
+        // 변 접촉(껍질 변 쌍, 상자 변 쌍)과 캡슐 선분 검사가 함께 쓴다.
+        static void ClosestSegmentPoints(const Vector3& p1, const Vector3& q1, const Vector3& p2, const Vector3& q2,
+                                         Vector3& c1, Vector3& c2);
+
+    private:
+        struct ClipVertex {
+            Vector3 position;
+            int clipPlane;          // 이 점을 만든 측면 + 1 (0이면 원래 입사 꼭짓점)
+            int incidentVertex;     // 출발한 입사 다각형 꼭짓점
+        };
+
+        std::vector<ClipVertex> polygon;
+        std::vector<ClipVertex> clipped;
+        std::vector<Vector3> referencePolygon;
+        std::vector<ContactPoint> candidates;
+
+        // referenceIsA면 A의 referenceFace가 기준 면, 아니면 B의 면
+        bool clipFaces(const ConvexHull& shapeA, const Transform& transformA,
+                       const ConvexHull& shapeB, const Transform& transformB,
+                       bool referenceIsA, int referenceFace, ContactManifold& manifold);
+
+        // 변 쌍의 최근접점으로 한 점
+        void edgeContact(const ConvexHull& shapeA, const Transform& transformA,
+                         const ConvexHull& shapeB, const Transform& transformB,
+                         const SATResult& sat, ContactManifold& manifold) const;
+
+        // 월드 점 pointA (A 표면), pointB (B 표면)로 접촉점 하나 생성
+        static ContactPoint makePoint(const Transform& inverseA, const Transform& inverseB,
+                                      const Vector3& pointA, const Vector3& pointB, float depth, uint64_t featureId);
+
+        // 가장 깊은 점, 가장 먼 점, 넓이가 가장 커지는 점 순으로 4점 선택
+        static void reducePoints(ContactManifold& manifold, const ContactPoint* candidates, int count);
+    };
+
+} // namespace Collision
+
+#endif // CONTACT_MANIFOLD_H
@@ -0,0 +1,88 @@
+#ifndef EPA_H
+#define EPA_H
+
+#include "../math/Vector3.h"
+#include "../math/Transform.h"
+#include "../decomposition/ConvexHull.h"
+#include "Simplex.h"
+#include <vector>
+#include <cstdint>
+
+namespace Collision {
+
+    // EPA 침투 결과
+    struct EPAResult {
+        Vector3 normal;     // A에서 B로 향하는 단위 접촉 법선 (B를 이 방향으로 depth만큼 옮기면 분리)
+        float depth;        // 침투 깊이
+        Vector3 pointA;     // B 안으로 가장 깊이 들어간 A 위의 점 (월드)
+        Vector3 pointB;     // A 안으로 가장 깊이 들어간 B 위의 점 (월드)
+        int iterations;
+
+        EPAResult() : depth(0.0f), iterations(0) {}
+    };
+
+    // GJK가 끝난 단순체에서 시작하는 Expanding Polytope Algorithm
+    // 다면체 꼭짓점, 면, 지평선(horizon) 변은 생성 시 한 번 잡아 둔 고정 용량 풀에 두고
+    // 호출마다 개수만 0으로 되돌려 다시 쓰므로 접촉 계산 중 힙 할당이 없다.
+    class EPA {
+    public:
+        static const int MAX_VERTICES = 128;
+        static const int MAX_FACES = 256;
+        static const int MAX_EDGES = 128;
+        static const int MAX_ITERATIONS = 64;
+
+        EPA();
+
+        // simplex는 GJK::Intersect가 충돌로 끝났을 때 남긴 단순체 (꼭짓점 1~4개)
+        // 4개 미만이면 지원점을 더해 사면체로 키운 뒤 확장한다.
+        // 두 볼록체가 납작해 사면체를 만들 수 없으면 false
+        bool Penetration(
+            const ConvexHull& shapeA,
+            const Transform& transformA,
+            const ConvexHull& shapeB,
+            const Transform& transformB,
+            const Simplex& simplex,
+            EPAResult& result
+        );
+
+    private:
+        struct Face {
+            int v[3];           // 바깥에서 볼 때 반시계 방향 꼭짓점
+            Vector3 normal;     // 바깥 방향 단위 법선
+            float distance;     // 원점에서 면 평면까지 거리
+        };
+
+        struct Edge {
+            int a;
+            int b;
+        };
+
+        std::vector<SimplexVertex> vertices;    // 다면체 꼭짓점 풀
+        std::vector<Face> faces;                // 살아 있는 면 (제거 시 마지막 면과 교체)
+        std::vector<Edge> horizon;              // 이번 반복의 지평선 변
+        int vertexCount;
+        int faceCount;
+        int edgeCount;
+
+        int supportA;                           // 언덕 오르기 시작 정점
+        int supportB;
+
+        SimplexVertex support(const ConvexHull& shapeA, const Transform& transformA,
+                              const ConvexHull& shapeB, const Transform& transformB,
+                              const Vector3& direction);
+
+        // 단순체 꼭짓점이 4개가 될 때까지 지원점 추가, 실패하면 false
+        bool buildTetrahedron(const ConvexHull& shapeA, const Transform& transformA,
+                              const ConvexHull& shapeB, const Transform& transformB);
+
+        bool addFace(int a, int b, int c);
+        void addHorizonEdge(int a, int b);
+        int closestFace() const;
+
+        // 면의 원점 투영점에 대한 무게 중심 좌표로 A, B 위의 점 계산
+        void computeContactPoints(const Face& face, EPAResult& result) const;
+    };
+
+} // namespace Collision
+
+#endif // EPA_H
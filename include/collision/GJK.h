@@ -2,16 +2,69 @@
 #define GJK_H
 
 #include "../math/Vector3.h"
+#include "../math/Transform.h"
 #include "../decomposition/ConvexHull.h"
-#include <vector>
+#include "Simplex.h"
+#include <cstdint>
 
 namespace Collision {
 
+    // 객체 쌍 하나의 프레임 간 GJK 캐시
+    struct GJKCache {
+        int supportA;       // 마지막 지원점 정점 (언덕 오르기 시작점, -1이면 없음)
+        int supportB;
+
+        // 웜 스타트 상태
+        Vector3 direction;  // 마지막 탐색 방향 (분리된 경우 분리 방향)
+        bool hasDirection;
+        int simplexA[4];    // 마지막 단순체 꼭짓점의 A/B 정점 인덱스
+        int simplexB[4];
+        int simplexCount;
+        int coldIterations; // 캐시 없이 처음 실행했을 때의 반복 수 (-1이면 아직 없음)
+
+        GJKCache() : supportA(-1), supportB(-1), hasDirection(false), simplexCount(0), coldIterations(-1) {}
+    };
+
+    // GJK 반복 통계
+    struct GJKStats {
+        uint64_t calls;             // Intersect 호출 수
+        uint64_t iterations;        // 지원 함수 호출 수 합계
+        uint64_t warmStarts;        // 캐시로 시작한 호출 수
+        uint64_t savedIterations;   // 웜 스타트로 줄어든 반복 수 (처음 실행한 반복 수 기준)
+
+        GJKStats() : calls(0), iterations(0), warmStarts(0), savedIterations(0) {}
+    };
+
+    // GJK 거리 질의 결과
+    struct GJKDistanceResult {
+        float distance;         // 두 볼록체 사이 최단 거리 (겹치면 0)
+        Vector3 pointA;         // A 위의 최근접점 (월드)
+        Vector3 pointB;         // B 위의 최근접점 (월드)
+        Vector3 separatingAxis; // A에서 B로 향하는 단위 분리축 (겹치면 0 벡터)
+        bool intersecting;
+
+        GJKDistanceResult() : distance(0.0f), intersecting(false) {}
+    };
+
+    // GJK 형태 이동(광선 투사) 결과
+    struct GJKCastResult {
+        float fraction;         // 이동량 중 처음 닿는 비율 (처음부터 겹치면 0)
+        Vector3 normal;         // 닿는 순간 B 표면의 바깥 법선 (A 쪽을 향하는 단위 벡터)
+        Vector3 pointA;         // 닿는 순간 A 위의 점 (월드, 이동 후 자세)
+        Vector3 pointB;         // 닿는 순간 B 위의 점 (월드)
+        bool hit;
+
+        GJKCastResult() : fraction(1.0f), hit(false) {}
+    };
+
     class GJK {
     public:
+        // 단순체 하나를 만드는 최대 반복 횟수
+        static const int MAX_ITERATIONS = 64;
+
         GJK() {}
 
-        // 두 볼록체(ConvexHull)의 충돌 여부 판단 함수
+        // 두 볼록체(ConvexHull)의 충돌 여부 판단 함수 (평행 이동만 적용)
         bool Intersect(
             const ConvexHull& shapeA, 
             const ConvexHull& shapeB,
@@ -19,31 +72,89 @@ namespace Collision {
             const Vector3& posB
         );
 
-        bool DoSimplex(std::vector<Vector3>& simplex, Vector3& direction);
+        // 회전/스케일을 포함한 변환이 적용된 두 볼록체의 충돌 여부
+        // cache가 있으면 지난 프레임의 지원점 정점에서 언덕 오르기를 시작하고 결과로 갱신
+        // 지난 단순체가 아직 원점을 감싸면 바로 충돌, 아니면 지난 탐색 방향에서 시작 (웜 스타트)
+        bool Intersect(
+            const ConvexHull& shapeA,
+            const Transform& transformA,
+            const ConvexHull& shapeB,
+            const Transform& transformB,
+            GJKCache* cache = nullptr
+        );
 
-        bool doLine(std::vector<Vector3>& simplex, Vector3& direction);
+        // 충돌이면 원점을 포함하는 마지막 단순체를 simplex에 남기는 Intersect (EPA 시작 단순체)
+        bool Intersect(
+            const ConvexHull& shapeA,
+            const Transform& transformA,
+            const ConvexHull& shapeB,
+            const Transform& transformB,
+            Simplex& simplex,
+            GJKCache* cache = nullptr
+        );
 
-        bool doTriangle(std::vector<Vector3>& simplex, Vector3& direction);
+        // 변환된 두 볼록체 사이의 최단 거리와 양쪽 최근접점, 분리축
+        // Intersect와 같은 반복(지원 함수, 캐시, 웜 스타트)을 쓰되 분리가 확인된 뒤에도
+        // 최근접점으로 수렴할 때까지 진행한다. 겹치면 0을 반환 (침투 깊이는 EPA로 계산)
+        float Distance(
+            const ConvexHull& shapeA,
+            const Transform& transformA,
+            const ConvexHull& shapeB,
+            const Transform& transformB,
+            GJKDistanceResult& result,
+            GJKCache* cache = nullptr
+        );
 
-        bool doTetrahedron(std::vector<Vector3>& simplex, Vector3& direction);
+        // A를 translation만큼 평행 이동할 때 B에 처음 닿는 비율 (Van den Bergen GJK 광선 투사)
+        // Minkowski 차 A - B에 원점에서 -translation 방향 광선을 쏘아, 지원점이 만드는 분리 평면마다
+        // 광선 매개변수를 평면까지 전진시키고 단순체를 광선 위의 점 기준으로 다시 줄여 간다.
+        // maxFraction보다 멀리 닿거나 멀어지는 중이면 false, 반복 한도 안에 표면까지 수렴하지 못해도 false
+        bool Cast(
+            const ConvexHull& shapeA,
+            const Transform& transformA,
+            const ConvexHull& shapeB,
+            const Transform& transformB,
+            const Vector3& translation,
+            GJKCastResult& result,
+            float maxFraction = 1.0f
+        );
 
         // 두 객체의 Minkowski 차 집합에서 주어진 방향의 지원 점을 반환
         Vector3 Support(const ConvexHull& shapeA, const ConvexHull& shapeB, 
             const Vector3& dir, const Vector3& posA, const Vector3& posB);
 
+        // 변환된 두 볼록체의 Minkowski 차 지원 점 (호출마다 방향 변환 2번, 정점 변환 2번)
+        Vector3 Support(const ConvexHull& shapeA, const Transform& transformA,
+            const ConvexHull& shapeB, const Transform& transformB, const Vector3& dir);
+
+        // 캐시된 정점에서 시작하는 지원 점 (인접 정보가 있는 껍질은 언덕 오르기)
+        Vector3 Support(const ConvexHull& shapeA, const Transform& transformA,
+            const ConvexHull& shapeB, const Transform& transformB, const Vector3& dir,
+            GJKCache& cache);
+
+        const GJKStats& getStats() const { return stats; }
+        void resetStats() { stats = GJKStats(); }
+
     private:
+        GJKStats stats;
 
-        Vector3 getFarthestPointInDirection(const ConvexHull& shape, 
-            const Vector3& dir, 
-            const Vector3& position
-        );
+        // 웜 스타트 판단과 통계를 포함한 Intersect/Distance 공통 경로
+        bool run(const ConvexHull& shapeA, const Transform& transformA,
+                 const ConvexHull& shapeB, const Transform& transformB,
+                 GJKCache* cache, bool untilClosest, Simplex& simplex, Vector3& closest);
 
-        // 현재 단순체(simplex)를 분석하여 원점을 포함하는지 판단하고,
-        // 그렇지 않다면 새로운 검색 방향을 업데이트합니다.
-        bool HandleSimplex(std::vector<Vector3>& simplex, Vector3& direction);
+        // direction에서 시작하는 GJK 반복, 끝나면 cache에 방향과 단순체 정점 기록
+        // 고정 크기 Simplex로 원점에 가장 가까운 점 closest를 추적하므로 힙 할당이 없다.
+        // untilClosest면 분리된 경우에도 closest가 최근접점으로 수렴할 때까지 반복
+        bool solve(const ConvexHull& shapeA, const Transform& transformA,
+                   const ConvexHull& shapeB, const Transform& transformB,
+                   Vector3 direction, GJKCache& cache,
+                   bool untilClosest, Simplex& simplex, Vector3& closest, int& iterations);
 
-        // 원점과 심플렉스 간 거리 계산 함수 추가
-        float calculateDistanceToOrigin(const std::vector<Vector3>& simplex);
+        // 캐시된 사면체 단순체가 현재 변환에서도 원점을 포함하는지 확인하고, 포함하면 simplex에 채움
+        bool loadCachedSimplex(const ConvexHull& shapeA, const Transform& transformA,
+                               const ConvexHull& shapeB, const Transform& transformB,
+                               const GJKCache& cache, Simplex& simplex) const;
     };
 
 } // namespace Collision
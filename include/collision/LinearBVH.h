@@ -0,0 +1,97 @@
+#ifndef LINEAR_BVH_H
+#define LINEAR_BVH_H
+
+#include "../geometry/AABB.h"
+#include "../geometry/AABBSoA.h"
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <utility>
+#include <cstdint>
+
+namespace Collision {
+
+// LBVH 노드
+// 배열 앞쪽 n - 1개는 내부 노드(0번이 루트), 뒤쪽 n개는 Morton 순서의 리프
+struct LBVHNode {
+    AABB bounds;
+    int left;                       // 자식 노드 인덱스 (리프는 -1)
+    int right;
+    int parent;
+    int primitive;                  // 리프의 기본체 번호 (내부 노드는 -1)
+
+    bool isLeaf() const { return primitive >= 0; }
+};
+
+// Morton 코드와 병렬 기수 정렬, Karras(2012) 방식으로 구축하는 선형 BVH
+// 모든 단계가 기본체/노드 단위로 독립적이라 OpenMP로 코어 수만큼 나눠 처리한다.
+// 순간이동이나 장면 로드 후 처음부터 다시 구축할 때 사용한다.
+class LinearBVH {
+public:
+    static const int MAX_STACK = 96;    // 깊이는 공통 접두사 길이(최대 62)로 제한됨
+
+    LinearBVH() : leafCount(0), visitCapacity(0) {}
+
+    // SoA AABB 목록으로 트리 구축 (기본체 번호 = bounds 인덱스)
+    void build(const AABBSoA& bounds);
+    void clear();
+
+    bool empty() const { return leafCount == 0; }
+    size_t getLeafCount() const { return leafCount; }
+    const std::vector<LBVHNode>& getNodes() const { return nodes; }
+
+    // 겹치는 기본체 번호 쌍 (각 리프가 병렬로 트리를 질의)
+    void findCollisionPairs(std::vector<std::pair<int, int>>& pairs);
+
+    // 주어진 AABB와 겹치는 기본체마다 callback(기본체 번호) 호출
+    template <typename Callback>
+    void query(const AABB& aabb, Callback callback) const {
+        if (leafCount == 0) {
+            return;
+        }
+
+        int stack[MAX_STACK];
+        int top = 0;
+        stack[top++] = 0;
+
+        while (top > 0) {
+            const LBVHNode& node = nodes[stack[--top]];
+            if (!node.bounds.intersects(aabb)) {
+                continue;
+            }
+            if (node.isLeaf()) {
+                callback(node.primitive);
+            } else {
+                stack[top++] = node.right;
+                stack[top++] = node.left;
+            }
+        }
+    }
+
+    // 10비트 정수 세 개를 교차 배치해 30비트 Morton 코드 생성
+    static uint32_t expandBits(uint32_t v);
+    static uint32_t mortonCode(float x, float y, float z);
+
+private:
+    std::vector<LBVHNode> nodes;
+    std::vector<uint32_t> mortonCodes;          // 정렬된 Morton 코드
+    std::vector<uint32_t> sortedPrimitives;     // 정렬된 기본체 번호
+    std::vector<uint32_t> keyScratch;           // 기수 정렬용 보조 버퍼
+    std::vector<uint32_t> valueScratch;
+    std::vector<uint32_t> histograms;           // 스레드별 자릿수 히스토그램
+    std::vector<std::vector<std::pair<int, int>>> threadPairs;
+    std::unique_ptr<std::atomic<int>[]> visitCounters;  // 상향식 AABB 계산용
+    size_t leafCount;
+    size_t visitCapacity;
+
+    void radixSort();
+    void buildHierarchy();
+    void computeBounds(const AABBSoA& bounds);
+
+    // 정렬된 i, j 번째 코드의 공통 접두사 길이 (코드가 같으면 인덱스로 구분)
+    int commonPrefix(int i, int j) const;
+};
+
+} // namespace Collision
+
+#endif // LINEAR_BVH_H
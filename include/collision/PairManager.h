@@ -0,0 +1,134 @@
+#ifndef PAIR_MANAGER_H
+#define PAIR_MANAGER_H
+
+#include "GJK.h"
+#include "SAT.h"
+#include "ContactManifold.h"
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+class Object3D;
+
+namespace Collision {
+
+    // 볼록 껍질 쌍 하나의 프레임 간 캐시 (PairManager 풀의 항목)
+    // 같은 객체 쌍의 항목끼리 next로 원형 연결되어 있다.
+    struct HullPairCache {
+        int hullA;                  // A 껍질 번호
+        int hullB;                  // B 껍질 번호
+        uint32_t lastFrame;         // 마지막으로 쓴 프레임
+        int next;                   // 같은 객체 쌍의 다음 항목 (풀 인덱스)
+        GJKCache gjk;
+        SATCache sat;               // 마지막 분리 축 (SAT 정밀 단계)
+    };
+
+    // 프레임 간에 유지되는 객체 쌍 하나의 상태
+    struct CollisionPair {
+        uint64_t key;               // (작은 ID << 32) | 큰 ID
+        Object3D* objectA;          // 작은 ID 쪽 객체
+        Object3D* objectB;          // 큰 ID 쪽 객체
+        uint32_t lastFrame;         // 마지막으로 대략적 단계에서 보고된 프레임
+        bool colliding;             // 마지막 정밀 검사 결과
+        int hullCacheIndex;         // 마지막으로 찾은 껍질 쌍 캐시의 풀 인덱스 (-1이면 없음)
+        int manifoldIndex;          // PairManager 접촉 다양체 풀 인덱스 (-1이면 없음)
+    };
+
+    // 객체 ID 쌍을 키로 하는 개방 주소법(선형 탐사) 쌍 테이블
+    // 쌍은 dense 배열에 두고 해시 테이블에는 배열 인덱스만 저장한다.
+    // 매 프레임 보고된 쌍에 프레임 번호를 찍어 두고, 찍히지 않은 쌍만 dense 배열에서 골라 제거하므로
+    // 시작(enter)/유지(stay)/종료(exit)를 맵을 새로 만들지 않고 구분할 수 있다.
+    class PairManager {
+    public:
+        PairManager() : frame(0) {}
+
+        static uint64_t makeKey(uint32_t idA, uint32_t idB) {
+            return idA < idB ? (static_cast<uint64_t>(idA) << 32) | idB
+                             : (static_cast<uint64_t>(idB) << 32) | idA;
+        }
+
+        // 새 프레임 시작 (이후 touch되지 않은 쌍은 removeStale에서 제거)
+        void beginFrame() { ++frame; }
+
+        // 쌍을 찾거나 새로 추가하고 이번 프레임에 보고된 것으로 표시
+        // isNew는 이번 프레임에 처음 생긴 쌍인지 여부
+        CollisionPair& touch(Object3D* a, uint32_t idA, Object3D* b, uint32_t idB, bool& isNew);
+
+        CollisionPair* find(uint32_t idA, uint32_t idB);
+
+        // 쌍의 접촉 다양체 (없으면 nullptr)
+        // 다양체는 쌍과 별도의 빈 목록(free list) 풀에 두고 쌍이 제거되거나 충돌이 끝나면 빈 목록으로 돌려 재사용한다.
+        // 빈 항목이 없을 때만 풀이 늘어나므로, 동시에 충돌 중인 쌍 수가 최대치에 이른 뒤에는 할당이 없다.
+        const ContactManifold* getManifold(const CollisionPair& pair) const {
+            return pair.manifoldIndex >= 0 ? &manifolds[pair.manifoldIndex] : nullptr;
+        }
+
+        // fresh를 쌍의 다양체에 반영 (처음이면 풀에서 할당), 지난 프레임 점과 대응되는 점은 lifetime 유지
+        const ContactManifold& updateManifold(CollisionPair& pair, const ContactManifold& fresh);
+
+        // 쌍의 다양체를 풀에 반환
+        void releaseManifold(CollisionPair& pair);
+
+        // 쌍이 가진 (hullA, hullB) 껍질 쌍 캐시 (없으면 풀에서 할당하거나 두 프레임 넘게 쓰지 않은 항목을 초기화해 재사용)
+        // 중간 단계가 실제로 검사한 껍질 쌍만 항목을 가지므로 A 껍질 수 x B 껍질 수 배열을 쌍마다 만들지 않는다.
+        // 마지막으로 찾은 항목 다음부터 찾으므로 껍질 쌍을 지난 프레임과 같은 순서로 검사하면 한 번에 맞는다.
+        // 항목은 쌍이 제거될 때 풀에 반환되며, 캐시된 정점/면 인덱스는 사용하는 쪽(GJK/SAT)에서 범위를 확인한다.
+        HullPairCache& hullCache(CollisionPair& pair, int hullA, int hullB);
+
+        // 이번 프레임에 보고되지 않은 쌍 제거, 제거 직전 onRemoved(쌍) 호출
+        template <typename Callback>
+        void removeStale(Callback onRemoved) {
+            for (size_t i = pairs.size(); i-- > 0;) {
+                if (pairs[i].lastFrame != frame) {
+                    onRemoved(pairs[i]);
+                    removeAt(i);
+                }
+            }
+        }
+
+        // ID가 id인 객체가 포함된 쌍 모두 제거 (객체 제거 시)
+        template <typename Callback>
+        void removeObject(uint32_t id, Callback onRemoved) {
+            for (size_t i = pairs.size(); i-- > 0;) {
+                uint64_t key = pairs[i].key;
+                if (static_cast<uint32_t>(key >> 32) == id || static_cast<uint32_t>(key) == id) {
+                    onRemoved(pairs[i]);
+                    removeAt(i);
+                }
+            }
+        }
+
+        void clear();
+
+        size_t size() const { return pairs.size(); }
+        const std::vector<CollisionPair>& getPairs() const { return pairs; }
+
+    private:
+        static constexpr uint32_t EMPTY = 0xFFFFFFFFu;
+
+        std::vector<CollisionPair> pairs;       // 활성 쌍 (제거 시 마지막 원소와 교체)
+        std::vector<uint32_t> table;            // pairs 인덱스 (크기는 2의 거듭제곱)
+        std::vector<ContactManifold> manifolds; // 접촉 다양체 풀 (빈 항목이 없을 때만 늘어남)
+        std::vector<int> freeManifolds;         // 비어 있는 풀 인덱스
+        std::vector<HullPairCache> hullCaches;  // 껍질 쌍 캐시 풀
+        std::vector<int> freeHullCaches;        // 비어 있는 풀 인덱스
+        uint32_t frame;
+
+        void removeAt(size_t index);
+        void releaseHullCaches(CollisionPair& pair);
+        void grow();
+        size_t findSlot(uint64_t key) const;    // key가 있는 슬롯, 없으면 EMPTY 슬롯
+
+        static uint32_t hashKey(uint64_t key) {
+            key ^= key >> 33;
+            key *= 0xff51afd7ed558ccdULL;
+            key ^= key >> 33;
+            key *= 0xc4ceb9fe1a85ec53ULL;
+            key ^= key >> 33;
+            return static_cast<uint32_t>(key);
+        }
+    };
+
+} // namespace Collision
+
+#endif // PAIR_MANAGER_H
@@ -2,8 +2,12 @@
 #define SAT_H
 
 #include "../math/Vector3.h"
+#include "../math/Transform.h"
 #include "../geometry/OBB.h"
+#include "../decomposition/ConvexHull.h"
 #include <vector>
+#include <cstddef>
+#include <cstdint>
 
 namespace Collision {
 
@@ -11,10 +15,93 @@ namespace Collision {
     public:
         static bool TestOBBCollision(const OBB& obbA, const OBB& obbB);
 
+        // obb 하나를 others[0..count)와 검사해 겹치는 인덱스를 out에 기록하고 개수 반환
+        static size_t TestOBBBatch(const OBB& obb, const OBB* others, size_t count, uint32_t* out);
+    };
+
+    // 최소 분리(또는 최소 침투)를 준 특징
+    enum class SATFeature {
+        NONE,
+        FACE_A,     // A의 면 법선 (indexA = A 면)
+        FACE_B,     // B의 면 법선 (indexB = B 면)
+        EDGES       // A 변 x B 변 (indexA = A 변, indexB = B 변)
+    };
+
+    // 껍질 쌍별로 프레임 간에 유지하는 마지막 분리 축 (특징 인덱스로 저장해 자세가 바뀌어도 다시 계산 가능)
+    struct SATCache {
+        SATFeature feature;
+        int indexA;
+        int indexB;
+
+        SATCache() : feature(SATFeature::NONE), indexA(-1), indexB(-1) {}
+    };
+
+    struct SATResult {
+        SATFeature feature;
+        int indexA;
+        int indexB;
+        Vector3 normal;         // A에서 B로 향하는 단위 축 (월드)
+        float separation;       // 축 위 거리 (양수면 분리, 음수면 -separation이 침투 깊이)
+
+        SATResult() : feature(SATFeature::NONE), indexA(-1), indexB(-1), separation(0.0f) {}
+
+        // 면 접촉일 때 기준 면을 가진 쪽과 그 면 (변 접촉이면 -1)
+        bool referenceIsA() const { return feature == SATFeature::FACE_A; }
+        int referenceFace() const {
+            return feature == SATFeature::FACE_A ? indexA : (feature == SATFeature::FACE_B ? indexB : -1);
+        }
+    };
+
+    // 볼록 다면체 쌍의 분리 축 검사 (Gregorius, "The Separating Axis Test between Convex Polyhedra")
+    // 두 껍질의 면 법선과 변 쌍 외적을 축으로 검사하되, 변 쌍은 Gauss 사상 위의 두 호가 교차할 때
+    // (Minkowski 차의 면을 만들 때)만 검사한다. 캐시가 있으면 지난 분리 축을 먼저 검사해 바로 끝낸다.
+    // 껍질에는 ConvexHull::buildFeatures로 만든 면/변 정보가 있어야 한다.
+    // 월드 정점/법선 버퍼는 객체에 두고 재사용하므로 크기가 정해진 뒤에는 힙 할당이 없다.
+    class HullSAT {
+    public:
+        HullSAT() {}
+
+        // 겹치면 true, result에는 최소 침투(또는 분리를 찾은) 축과 기준 특징
+        bool Intersect(
+            const ConvexHull& shapeA,
+            const Transform& transformA,
+            const ConvexHull& shapeB,
+            const Transform& transformB,
+            SATResult& result,
+            SATCache* cache = nullptr
+        );
+
+        // 원점 중심, 반 크기 1인 상자 껍질 (OBB를 boxTransform과 함께 껍질로 검사할 때)
+        static const ConvexHull& unitBox();
+        static Transform boxTransform(const OBB& box);
+
     private:
-        static bool OverlapOnAxis(const OBB& obbA, const OBB& obbB, const Vector3& axis);
+        struct WorldHull {
+            std::vector<Vector3> vertices;
+            std::vector<Vector3> normals;
+            std::vector<float> offsets;
+            Vector3 centroid;
+        };
+
+        WorldHull worldA;
+        WorldHull worldB;
+
+        static void toWorld(const ConvexHull& shape, const Transform& transform, WorldHull& world);
+
+        // faces 껍질의 face 면 평면에서 other 껍질까지의 거리
+        static float faceSeparation(const WorldHull& faces, int face, const WorldHull& other);
+        static float queryFaces(const WorldHull& faces, const WorldHull& other, int& bestFace);
+
+        // 분리 축을 만들지 못하는 변 쌍(평행)이면 -최대값
+        float edgeSeparation(const ConvexHull& shapeA, int edgeA, const ConvexHull& shapeB, int edgeB,
+                             Vector3& axis) const;
+        float queryEdges(const ConvexHull& shapeA, const ConvexHull& shapeB, int& bestA, int& bestB,
+                         Vector3& bestAxis) const;
+
+        // Gauss 사상에서 호 (a, b)와 호 (c, d)가 교차하는지
+        static bool isMinkowskiFace(const Vector3& a, const Vector3& b, const Vector3& c, const Vector3& d);
     };
 
 } // namespace Collision
 
-#endif // SAT_H
\ No newline at end of file
+#endif // SAT_H
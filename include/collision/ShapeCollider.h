@@ -0,0 +1,35 @@
+#ifndef SHAPE_COLLIDER_H
+#define SHAPE_COLLIDER_H
+
+#include "../math/Transform.h"
+#include "../geometry/Shape.h"
+#include "SAT.h"
+#include "ContactManifold.h"
+
+namespace Collision {
+
+    // 기본 도형 쌍의 닫힌 식 정밀 검사
+    // (구, 캡슐, 상자) 쌍별 검사 함수를 템플릿으로 생성한 ShapeType × ShapeType 함수 표에서 찾는다.
+    // 닫힌 식이 없는 쌍(HULL이 낀 쌍, 캡슐-상자)은 표가 비어 있어 GJK/EPA 또는 다면체 SAT로 처리한다.
+    class ShapeCollider {
+    public:
+        ShapeCollider() {}
+
+        // 두 형태 쌍에 닫힌 식 검사가 있는지
+        static bool HasClosedForm(ShapeType typeA, ShapeType typeB);
+
+        // 닫힌 식으로 충돌 여부를 검사하고, 충돌하면 A에서 B로 향하는 법선과 접촉점을 manifold에,
+        // 침투 깊이(B를 법선 방향으로 이만큼 옮기면 분리)를 depth에 기록
+        // transformA/B는 접촉점 로컬 좌표(다양체 유지용)의 기준 (상자-상자는 상자 껍질 변환 기준)
+        // 닫힌 식이 없는 쌍이면 false
+        bool Collide(const WorldShape& shapeA, const Transform& transformA,
+                     const WorldShape& shapeB, const Transform& transformB,
+                     ContactManifold& manifold, float& depth);
+
+    private:
+        ManifoldBuilder manifoldBuilder;    // 상자-상자 면 자르기 버퍼
+    };
+
+} // namespace Collision
+
+#endif // SHAPE_COLLIDER_H
@@ -0,0 +1,87 @@
+#ifndef SIMPLEX_H
+#define SIMPLEX_H
+
+#include "../math/Vector3.h"
+#include <cstdint>
+
+namespace Collision {
+
+    // GJK 단순체 꼭짓점 하나 (Minkowski 차 점과 그 점을 만든 양쪽 지원점)
+    struct SimplexVertex {
+        Vector3 w;          // a - b
+        Vector3 a;          // A의 월드 지원점
+        Vector3 b;          // B의 월드 지원점
+        int indexA;         // a의 정점 인덱스
+        int indexB;
+    };
+
+    // 슬롯 4개와 활성 비트마스크로 관리하는 고정 크기 단순체 (Johnson 부분 알고리즘)
+    // 부분 집합별 행렬식 det[부분 집합][꼭짓점]과 꼭짓점 간 변 벡터를 캐시해 두고,
+    // 꼭짓점이 추가될 때 새 꼭짓점이 포함된 항목만 다시 계산한다.
+    // 힙 할당이 없으므로 GJK 한 번이 스택 위에서 끝난다.
+    class Simplex {
+    public:
+        static const int MAX_VERTICES = 4;
+
+        Simplex() : bits(0), allBits(0), last(0), lastBit(0) {}
+
+        void clear() { bits = 0; allBits = 0; }
+
+        // 빈 슬롯에 꼭짓점을 넣고 새 꼭짓점이 포함된 행렬식 갱신
+        // 활성 집합은 closest 호출로 다시 정해진다.
+        void add(const SimplexVertex& vertex);
+
+        // 꼭짓점을 넣고 축소 없이 바로 활성 집합에 포함 (캐시된 단순체를 다시 만들 때)
+        void push(const SimplexVertex& vertex) { add(vertex); bits = allBits; }
+
+        // 원점에 가장 가까운 점 v를 계산하고 그 점을 포함하는 최소 부분 단순체로 축소
+        // 어느 부분 집합도 조건을 만족하지 못하면(수치 오차) false
+        bool closest(Vector3& v);
+
+        // closest와 같지만 새 꼭짓점이 빠진 부분 집합까지 모두 검사
+        // GJK 광선 투사처럼 꼭짓점 기준점이 옮겨 가면 가장 가까운 부분 단순체가 새 꼭짓점을 포함한다는 보장이 없다.
+        // 조건을 만족하는 부분 집합이 없으면 무게 중심 좌표가 모두 양수인 것 중 가장 가까운 부분 집합을 쓴다.
+        bool closestAny(Vector3& v);
+
+        // 마지막 add 이전의 활성 집합으로 되돌림 (add가 새 꼭짓점을 포함한 행렬식만 덮어쓰므로
+        // 이전 집합의 행렬식과 꼭짓점은 그대로 남아 있다)
+        void restore(uint32_t previousBits) { bits = previousBits; allBits = previousBits; }
+
+        // w가 이미 단순체에 있는 점인지 (같은 지원점이 다시 나오면 더 진행할 수 없음)
+        bool contains(const Vector3& w) const;
+
+        // contains와 같지만 활성 꼭짓점만 비교 (closestAny가 버린 꼭짓점은 다시 넣을 수 있음)
+        bool containsActive(const Vector3& w) const;
+
+        // 활성 꼭짓점 중 원점에서 가장 먼 거리의 제곱 (종료 조건의 상대 오차 기준)
+        float maxLengthSquared() const;
+
+        // 현재 무게 중심 좌표로 A, B 쪽 최근접점 계산
+        void computePoints(Vector3& pointA, Vector3& pointB) const;
+
+        bool isFull() const { return bits == 0xF; }
+        bool isEmpty() const { return bits == 0; }
+        int size() const;
+
+        uint32_t getBits() const { return bits; }
+        const SimplexVertex& getVertex(int slot) const { return vertices[slot]; }
+
+    private:
+        SimplexVertex vertices[MAX_VERTICES];
+        Vector3 edges[MAX_VERTICES][MAX_VERTICES];  // edges[i][j] = w_i - w_j
+        float det[16][MAX_VERTICES];                // 부분 집합(비트마스크)별 Johnson 행렬식
+
+        uint32_t bits;          // 활성 꼭짓점 슬롯
+        uint32_t allBits;       // 활성 슬롯 + 마지막으로 추가된 슬롯
+        int last;               // 마지막으로 추가된 슬롯
+        uint32_t lastBit;
+
+        void computeDeterminants();
+        bool isValid(uint32_t subset) const;
+        float maxLengthSquared(uint32_t subset) const;
+        void computeVector(uint32_t subset, Vector3& v) const;
+    };
+
+} // namespace Collision
+
+#endif // SIMPLEX_H
@@ -0,0 +1,85 @@
+#ifndef SPATIAL_HASH_H
+#define SPATIAL_HASH_H
+
+#include "../geometry/AABB.h"
+#include "../geometry/AABBSoA.h"
+#include <vector>
+#include <utility>
+#include <cstdint>
+
+namespace Collision {
+
+    // 균일 격자를 해시 테이블에 저장하는 대략적 충돌 감지
+    // 객체는 월드 AABB가 겹치는 모든 셀에 들어가고, 셀마다 쌍을 찾는다.
+    // 객체를 따로 등록하지 않고 매 프레임 SoA AABB 배열의 인덱스로 처리한다.
+    // 셀 테이블은 개방 주소법(선형 탐사)으로 구성하고 프레임 번호(stamp)로 비우므로
+    // 객체 수가 늘지 않는 한 매 프레임 메모리를 할당하지 않는다.
+    class SpatialHashGrid {
+    public:
+        // 한 객체가 이보다 많은 셀을 덮으면 격자 대신 전체 객체와 직접 검사
+        static const int MAX_CELLS_PER_OBJECT = 512;
+
+        explicit SpatialHashGrid(float cellSize = 1.0f);
+
+        void clear();
+
+        // 셀 크기 설정 (대체로 객체 크기와 비슷하게 맞출 때 가장 빠름)
+        void setCellSize(float size);
+        float getCellSize() const { return cellSize; }
+
+        // bounds로 격자를 다시 채우고 겹치는 인덱스 쌍을 반환
+        void findCollisionPairs(const AABBSoA& bounds, std::vector<std::pair<int, int>>& collisionPairs);
+
+        size_t getObjectCount() const { return proxies.size(); }
+        size_t getCellCount() const { return usedSlots.size(); }
+
+    private:
+        // 객체 하나의 이번 프레임 셀 범위
+        struct Proxy {
+            int minCell[3];
+            int maxCell[3];
+            bool oversized;
+        };
+
+        // 해시 테이블 슬롯 (stamp가 현재 프레임과 다르면 빈 슬롯)
+        struct Slot {
+            int x, y, z;
+            uint32_t stamp;
+            uint32_t head;          // 셀에 들어간 첫 항목 (entries 인덱스)
+        };
+
+        // 셀 안의 객체 목록 (단일 연결 리스트)
+        struct Entry {
+            uint32_t proxy;
+            uint32_t next;
+        };
+
+        static const uint32_t NONE = 0xFFFFFFFFu;
+
+        float cellSize;
+        float invCellSize;
+
+        std::vector<Proxy> proxies;         // bounds와 같은 인덱스
+
+        std::vector<Slot> slots;            // 크기는 항상 2의 거듭제곱
+        std::vector<Entry> entries;
+        std::vector<uint32_t> usedSlots;    // 이번 프레임에 사용된 슬롯
+        std::vector<uint32_t> oversized;    // 격자에 넣지 않은 큰 객체
+        std::vector<uint32_t> cellScratch;  // 셀 하나의 객체 목록 임시 버퍼
+        std::vector<uint32_t> hitScratch;   // 큰 객체 일괄 검사 결과 버퍼
+        uint32_t stamp;
+
+        int toCell(float value) const;
+        void ensureCapacity(size_t cellInsertions);
+        void insert(int x, int y, int z, uint32_t proxy);
+
+        static uint32_t hashCell(int x, int y, int z) {
+            return (static_cast<uint32_t>(x) * 73856093u) ^
+                   (static_cast<uint32_t>(y) * 19349663u) ^
+                   (static_cast<uint32_t>(z) * 83492791u);
+        }
+    };
+
+} // namespace Collision
+
+#endif // SPATIAL_HASH_H
@@ -0,0 +1,241 @@
+#ifndef STATIC_BVH_H
+#define STATIC_BVH_H
+
+#include "../geometry/AABB.h"
+#include "../geometry/AABBSoA.h"
+#include "../geometry/Ray.h"
+#include "../math/Vector3.h"
+#include "../math/Transform.h"
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+
+namespace Collision {
+
+// 정적 BVH 노드 (32바이트 정렬, 깊이 우선 순서로 평평한 배열에 저장)
+// 왼쪽 자식은 항상 바로 다음 인덱스이므로 오른쪽 자식만 저장한다.
+struct alignas(32) StaticBVHNode {
+    float minX, minY, minZ;
+    uint32_t offset;                // 내부 노드: 오른쪽 자식 인덱스, 리프: 첫 기본체 위치
+    float maxX, maxY, maxZ;
+    uint32_t count;                 // 리프의 기본체 수 (0이면 내부 노드)
+
+    bool isLeaf() const { return count != 0; }
+
+    bool intersects(const AABB& aabb) const {
+        return (minX <= aabb.max.x && maxX >= aabb.min.x) &&
+               (minY <= aabb.max.y && maxY >= aabb.min.y) &&
+               (minZ <= aabb.max.z && maxZ >= aabb.min.z);
+    }
+
+    AABB getAABB() const {
+        return AABB(Vector3(minX, minY, minZ), Vector3(maxX, maxY, maxZ));
+    }
+};
+
+static_assert(sizeof(StaticBVHNode) == 32, "StaticBVHNode must fit in 32 bytes");
+
+// 구간 분할(binned) SAH로 한 번 구축하는 정적 BVH
+// 정적이거나 거의 움직이지 않는 객체를 로드 시점에 묶어 두고 움직이는 객체의 AABB로 질의한다.
+class StaticBVH {
+public:
+    static const int BIN_COUNT = 16;        // 축마다 사용하는 구간 수
+    static const int MAX_DEPTH = 60;        // 질의 스택 크기를 고정하기 위한 최대 깊이
+
+    StaticBVH() : maxLeafSize(4) {}
+
+    // 기본체 AABB 목록으로 트리 구축 (기본체 번호 = bounds 인덱스)
+    // 리프 안의 기본체는 SIMD로 한 번에 검사하므로 리프를 조금 크게 잡는다.
+    void build(const std::vector<AABB>& bounds, int maxLeafSize = 4);
+    void clear();
+
+    bool empty() const { return nodes.empty(); }
+    const std::vector<StaticBVHNode>& getNodes() const { return nodes; }
+    const std::vector<int>& getPrimitiveIndices() const { return primitiveIndices; }
+
+    // 트리의 SAH 비용 (구축 품질 비교용)
+    float computeCost() const;
+
+    // 주어진 AABB와 겹치는 기본체마다 callback(기본체 번호) 호출 (힙 할당 없음)
+    template <typename Callback>
+    void query(const AABB& aabb, Callback callback) const {
+        if (nodes.empty()) {
+            return;
+        }
+
+        uint32_t stack[MAX_DEPTH + 1];
+        int top = 0;
+        stack[top++] = 0;
+
+        while (top > 0) {
+            uint32_t index = stack[--top];
+            const StaticBVHNode& node = nodes[index];
+            if (!node.intersects(aabb)) {
+                continue;
+            }
+
+            if (node.isLeaf()) {
+                uint32_t hits[AABBSoA::LANES];
+                uint32_t end = node.offset + node.count;
+                for (uint32_t begin = node.offset; begin < end; begin += AABBSoA::LANES) {
+                    uint32_t chunkEnd = std::min<uint32_t>(begin + AABBSoA::LANES, end);
+                    size_t hitCount = leafBounds.overlapBatch(aabb, begin, chunkEnd, hits);
+                    for (size_t h = 0; h < hitCount; ++h) {
+                        callback(primitiveIndices[hits[h]]);
+                    }
+                }
+            } else {
+                stack[top++] = node.offset;     // 오른쪽 자식
+                stack[top++] = index + 1;       // 왼쪽 자식 (먼저 방문)
+            }
+        }
+    }
+
+    void query(const AABB& aabb, std::vector<int>& results) const;
+
+    // 광선이 지나는 기본체마다 callback(기본체 번호, maxDistance) 호출
+    // 두 자식 중 광선이 먼저 들어가는 쪽부터 내려가고, callback이 더 가까운 교차를 찾아 maxDistance를 줄이면
+    // 그보다 뒤에서 시작하는 노드는 건너뛴다. 리프 안의 기본체는 SIMD 슬랩 검사로 한 번에 거른다.
+    template <typename Callback>
+    void raycast(const RaySlab& ray, float& maxDistance, Callback callback) const {
+        float tEntry;
+        if (nodes.empty() || !ray.intersect(nodes[0].getAABB(), maxDistance, tEntry)) {
+            return;
+        }
+
+        // (노드, 들어가는 t) 스택, 한 단계에 최대 두 개씩 쌓임
+        uint32_t stack[2 * MAX_DEPTH + 2];
+        float entry[2 * MAX_DEPTH + 2];
+        int top = 0;
+        stack[top] = 0;
+        entry[top] = tEntry;
+        ++top;
+
+        while (top > 0) {
+            --top;
+            if (entry[top] > maxDistance) {
+                continue;
+            }
+            uint32_t index = stack[top];
+            const StaticBVHNode& node = nodes[index];
+
+            if (node.isLeaf()) {
+                uint32_t hits[AABBSoA::LANES];
+                uint32_t end = node.offset + node.count;
+                for (uint32_t begin = node.offset; begin < end; begin += AABBSoA::LANES) {
+                    uint32_t chunkEnd = std::min<uint32_t>(begin + AABBSoA::LANES, end);
+                    size_t hitCount = leafBounds.raycastBatch(ray, maxDistance, begin, chunkEnd, hits);
+                    for (size_t h = 0; h < hitCount; ++h) {
+                        callback(primitiveIndices[hits[h]], maxDistance);
+                    }
+                }
+                continue;
+            }
+
+            uint32_t left = index + 1;
+            uint32_t right = node.offset;
+            float tLeft, tRight;
+            bool hitLeft = ray.intersect(nodes[left].getAABB(), maxDistance, tLeft);
+            bool hitRight = ray.intersect(nodes[right].getAABB(), maxDistance, tRight);
+            if (hitLeft && hitRight && tRight < tLeft) {
+                std::swap(left, right);
+                std::swap(tLeft, tRight);
+                std::swap(hitLeft, hitRight);
+            }
+            // 먼 쪽을 먼저 쌓아 가까운 쪽을 먼저 방문
+            if (hitRight) {
+                stack[top] = right;
+                entry[top] = tRight;
+                ++top;
+            }
+            if (hitLeft) {
+                stack[top] = left;
+                entry[top] = tLeft;
+                ++top;
+            }
+        }
+    }
+
+    // 두 트리를 동시에 내려가며 기본체 AABB가 겹치는 쌍마다 callback(이 트리 기본체, other 기본체) 호출
+    // otherToThis는 other의 로컬 좌표를 이 트리의 로컬 좌표로 옮기는 상대 변환 (회전/스케일 포함)
+    // other의 상자는 변환한 뒤 감싸는 AABB로 검사하므로 보수적이다 (겹치는 쌍은 빠뜨리지 않음).
+    // margin을 주면 other의 상자를 이 트리 로컬 단위로 그만큼 부풀려, 서로 margin 안에 있는 쌍도 보고한다.
+    template <typename Callback>
+    void queryTree(const StaticBVH& other, const Transform& otherToThis, Callback callback,
+                   float margin = 0.0f) const {
+        if (nodes.empty() || other.nodes.empty()) {
+            return;
+        }
+
+        Matrix3x3 absBasis = absoluteBasis(otherToThis.basis);
+        Vector3 inflate(margin, margin, margin);
+
+        // (이 트리 노드, other 노드) 쌍 스택, 깊이는 두 트리 깊이의 합으로 제한됨
+        uint32_t stack[2 * MAX_DEPTH + 2][2];
+        int top = 0;
+        stack[top][0] = 0;
+        stack[top][1] = 0;
+        ++top;
+
+        while (top > 0) {
+            --top;
+            uint32_t indexA = stack[top][0];
+            uint32_t indexB = stack[top][1];
+            const StaticBVHNode& nodeA = nodes[indexA];
+            const StaticBVHNode& nodeB = other.nodes[indexB];
+
+            AABB boundsB = transformBounds(nodeB.getAABB(), otherToThis, absBasis);
+            boundsB = AABB(boundsB.min - inflate, boundsB.max + inflate);
+            if (!nodeA.intersects(boundsB)) {
+                continue;
+            }
+
+            if (nodeA.isLeaf() && nodeB.isLeaf()) {
+                for (uint32_t j = nodeB.offset; j < nodeB.offset + nodeB.count; ++j) {
+                    AABB primitiveB = transformBounds(other.primitiveBounds[j], otherToThis, absBasis);
+                    primitiveB = AABB(primitiveB.min - inflate, primitiveB.max + inflate);
+                    for (uint32_t i = nodeA.offset; i < nodeA.offset + nodeA.count; ++i) {
+                        if (primitiveBounds[i].intersects(primitiveB)) {
+                            callback(primitiveIndices[i], other.primitiveIndices[j]);
+                        }
+                    }
+                }
+            } else if (nodeB.isLeaf() ||
+                       (!nodeA.isLeaf() && nodeA.getAABB().getSurfaceArea() >= boundsB.getSurfaceArea())) {
+                // 더 큰 쪽(또는 리프가 아닌 쪽)을 내려감
+                stack[top][0] = nodeA.offset;
+                stack[top][1] = indexB;
+                ++top;
+                stack[top][0] = indexA + 1;
+                stack[top][1] = indexB;
+                ++top;
+            } else {
+                stack[top][0] = indexA;
+                stack[top][1] = nodeB.offset;
+                ++top;
+                stack[top][0] = indexA;
+                stack[top][1] = indexB + 1;
+                ++top;
+            }
+        }
+    }
+
+private:
+    std::vector<StaticBVHNode> nodes;       // 깊이 우선 순서의 노드 배열
+    std::vector<int> primitiveIndices;      // 리프 순서로 재배열된 기본체 번호
+    std::vector<AABB> primitiveBounds;      // primitiveIndices와 같은 순서의 기본체 AABB
+    AABBSoA leafBounds;                     // primitiveBounds의 SoA 사본 (리프 검사용)
+    std::vector<Vector3> centroids;         // 구축 중 사용하는 기본체 중심점
+    int maxLeafSize;
+
+    void buildNode(int begin, int end, int depth);
+    static void setBounds(StaticBVHNode& node, const AABB& aabb);
+
+    // 상자를 변환하고 감싸는 AABB (중심은 변환, 반길이는 |basis| 곱)
+    static AABB transformBounds(const AABB& box, const Transform& transform, const Matrix3x3& absBasis);
+    static Matrix3x3 absoluteBasis(const Matrix3x3& basis);
+};
+
+} // namespace Collision
+
+#endif // STATIC_BVH_H
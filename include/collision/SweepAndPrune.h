@@ -0,0 +1,79 @@
+#ifndef SWEEP_AND_PRUNE_H
+#define SWEEP_AND_PRUNE_H
+
+#include "../core/Object3D.h"
+#include <vector>
+#include <unordered_map>
+#include <utility>
+#include <cstdint>
+
+namespace Collision {
+
+    // Sweep and Prune 대략적 충돌 감지
+    // 세 축의 정렬된 끝점 목록을 프레임 간에 유지하고 삽입 정렬로 갱신한다.
+    // 끝점이 서로 교차할 때만 쌍을 추가/제거하므로 움직임이 적은 프레임은 O(n + k)에 가깝다.
+    class SweepAndPrune {
+    public:
+        SweepAndPrune() {}
+
+        // 객체 관리
+        void addObject(Object3D* object);
+        void removeObject(Object3D* object);
+        void clear();
+
+        // 객체들의 월드 AABB를 끝점에 반영하고 삽입 정렬로 재정렬
+        void update();
+
+        // 현재 세 축 모두에서 겹치는 객체 쌍 반환
+        void getPairs(std::vector<std::pair<Object3D*, Object3D*>>& outPairs) const;
+
+        size_t getObjectCount() const { return objectToProxy.size(); }
+        size_t getPairCount() const { return pairs.size(); }
+
+    private:
+        // 정렬 목록의 끝점 (data = 프록시 번호 << 1 | 최대점 여부)
+        struct Endpoint {
+            float value;
+            uint32_t data;
+
+            uint32_t proxy() const { return data >> 1; }
+            bool isMax() const { return (data & 1u) != 0; }
+        };
+
+        // 객체 하나에 대응하는 프록시 (마지막으로 반영된 AABB 보관)
+        struct Proxy {
+            Object3D* object;
+            float min[3];
+            float max[3];
+        };
+
+        std::vector<Endpoint> endpoints[3];                  // 축별 정렬된 끝점 목록
+        std::vector<Proxy> proxies;                          // 프록시 배열
+        std::vector<uint32_t> freeProxies;                   // 재사용 가능한 프록시 번호
+        std::unordered_map<Object3D*, uint32_t> objectToProxy;
+
+        // 겹치는 쌍 목록 (제거 시 마지막 원소와 교체)
+        std::vector<std::pair<uint32_t, uint32_t>> pairs;
+        std::unordered_map<uint64_t, uint32_t> pairIndex;
+
+        void refreshProxy(Proxy& proxy);
+        void sortAxis(int axis);
+
+        bool overlaps(uint32_t a, uint32_t b) const;
+        void addPair(uint32_t a, uint32_t b);
+        void removePair(uint32_t a, uint32_t b);
+
+        // 같은 값이면 최소점이 최대점보다 앞에 오도록 정렬 (맞닿은 AABB도 겹침으로 처리)
+        static bool less(const Endpoint& a, const Endpoint& b) {
+            return a.value < b.value || (a.value == b.value && !a.isMax() && b.isMax());
+        }
+
+        static uint64_t pairKey(uint32_t a, uint32_t b) {
+            if (a > b) std::swap(a, b);
+            return (static_cast<uint64_t>(a) << 32) | b;
+        }
+    };
+
+} // namespace Collision
+
+#endif // SWEEP_AND_PRUNE_H
@@ -2,34 +2,75 @@
 #define COLLISION_MANAGER_H
 
 #include <vector>
-#include <unordered_map>
 #include <utility>
+#include <functional>
 #include "Object3D.h"
 #include "GJK.h"
+#include "EPA.h"
 #include "SAT.h"
 #include "OBB.h"
+#include "SweepAndPrune.h"
+#include "BVH.h"
+#include "StaticBVH.h"
+#include "SpatialHash.h"
+#include "LinearBVH.h"
+#include "PairManager.h"
+#include "ContactManifold.h"
+#include "ShapeCollider.h"
+#include "AABBSoA.h"
+#include "Ray.h"
 
 // 충돌 감지 알고리즘 열거형
 enum class CollisionAlgorithm {
     AABB,       // 축 정렬 경계 상자 충돌 감지
     GJK,        // Gilbert-Johnson-Keerthi 알고리즘
     SAT,        // Separating Axis Theorem
+    SAP,        // Sweep and Prune (대략적 충돌 감지 전용)
+    BVH,        // 동적 AABB 트리 (대략적 충돌 감지 전용)
+    SPATIAL_HASH, // 균일 격자 해시 (대략적 충돌 감지 전용)
+    LBVH,       // Morton 코드 기반 선형 BVH, 매 프레임 병렬 재구축 (대략적 충돌 감지 전용)
     CUSTOM      // 사용자 정의 알고리즘
 };
 
-// 충돌 쌍을 위한 해시 함수
-struct ObjectPairHash {
-    std::size_t operator()(const std::pair<Object3D*, Object3D*>& pair) const {
-        return std::hash<void*>{}(static_cast<void*>(pair.first)) ^ 
-               std::hash<void*>{}(static_cast<void*>(pair.second));
-    }
+// 광선 질의 결과
+struct RayHit {
+    Object3D* object;       // 맞은 객체 (없으면 nullptr)
+    float distance;         // 광선 원점에서 교차점까지 거리
+    Vector3 point;          // 교차점 (월드)
+    Vector3 normal;         // 교차한 면의 바깥 법선 (월드, 단위 벡터)
+    int hull;               // 교차한 볼록 껍질 번호 (껍질 목록을 쓰지 않는 객체는 0)
+
+    RayHit() : object(nullptr), distance(0.0f), hull(-1) {}
+
+    bool hit() const { return object != nullptr; }
+};
+
+// 객체 이동(shape cast) 질의 결과
+struct ShapeCastHit {
+    Object3D* object;       // 처음 닿는 객체 (없으면 nullptr)
+    float fraction;         // 이동량 중 닿기 전까지 움직일 수 있는 비율 (처음부터 겹치면 0)
+    float distance;         // 그 이동 거리
+    Vector3 point;          // 닿는 점 (월드, 상대 객체 표면)
+    Vector3 normal;         // 닿는 점에서 상대 객체 표면의 바깥 법선 (이동하는 객체 쪽)
+    int hull;               // 상대 객체에서 닿은 볼록 껍질 번호 (껍질 목록을 쓰지 않는 객체는 0)
+
+    ShapeCastHit() : object(nullptr), fraction(1.0f), distance(0.0f), hull(-1) {}
+
+    bool hit() const { return object != nullptr; }
 };
 
 // 충돌 감지와 해결을 관리하는 클래스
 class CollisionManager {
+public:
+    // 사용자 쌍 필터 (false를 반환하면 정밀 충돌 감지를 하지 않음)
+    using PairFilter = std::function<bool(Object3D*, Object3D*)>;
+
 private:
-    std::vector<Object3D*> objects;                            // 충돌 감지 대상 객체들
-    std::unordered_map<std::pair<Object3D*, Object3D*>, bool, ObjectPairHash> collisionState;  // 이전 충돌 상태
+    std::vector<Object3D*> objects;                            // 움직이는 객체들 (키네마틱/동적)
+    std::vector<Object3D*> staticObjects;                      // 정적 객체들 (서로 검사하지 않음)
+    PairFilter pairFilter;                                     // 레이어 검사 후 적용되는 사용자 필터
+    Collision::PairManager pairManager;                        // 프레임 간 유지되는 쌍별 충돌 상태
+    uint32_t nextObjectId;                                     // 다음에 등록되는 객체의 ID
 
     CollisionAlgorithm broadPhaseAlgorithm;                    // 대략적 충돌 감지 알고리즘
     CollisionAlgorithm narrowPhaseAlgorithm;                   // 정밀 충돌 감지 알고리즘
@@ -41,41 +82,182 @@ private:
     // GJK 인스턴스
     Collision::GJK gjkSolver;
 
+    // EPA 인스턴스 (다면체 풀을 호출 간에 재사용)
+    Collision::EPA epaSolver;
+
+    // 볼록 다면체 SAT 인스턴스 (월드 정점 버퍼를 호출 간에 재사용)
+    Collision::HullSAT satSolver;
+
+    // SAT/EPA 결과를 접촉 다양체로 바꾸는 자르기 버퍼
+    Collision::ManifoldBuilder manifoldBuilder;
+
+    // 구/캡슐/상자 쌍의 닫힌 식 검사 (형태 쌍별 함수 표)
+    Collision::ShapeCollider shapeCollider;
+
+    // Sweep and Prune 대략적 충돌 감지 (프레임 간 정렬 상태 유지)
+    Collision::SweepAndPrune sweepAndPrune;
+
+    // 동적 AABB 트리 (fat AABB를 벗어난 객체만 재삽입)
+    Collision::BVH dynamicTree;
+
+    // objects와 같은 순서의 월드 AABB (SoA, 매 검사 프레임 갱신)
+    AABBSoA worldBounds;
+    std::vector<uint32_t> overlapScratch;                      // 일괄 겹침 검사 결과 버퍼
+    std::vector<std::pair<int, int>> indexPairs;               // 인덱스 기반 대략적 단계 결과
+
+    // 균일 격자 해시 (셀 테이블을 프레임 간 재사용)
+    Collision::SpatialHashGrid spatialHash;
+
+    // 선형 BVH (매 프레임 처음부터 병렬 구축)
+    Collision::LinearBVH linearTree;
+
+    // 정적 객체용 SAH BVH (정적 객체가 바뀔 때만 재구축)
+    Collision::StaticBVH staticTree;
+    bool staticTreeDirty;
+
+    // 휴면과 접촉 섬 (충돌 중인 쌍으로 union-find)
+    int sleepThreshold;                                        // 이 프레임 수 동안 움직이지 않으면 휴면 (0이면 사용 안 함)
+    std::vector<int> islandParent;                             // union-find 부모 (objects 인덱스)
+    std::vector<int> islandStart;                              // 섬별 islandMembers 시작 위치
+    std::vector<Object3D*> islandMembers;                      // 섬 번호 순으로 정렬된 객체
+    bool islandsValid;                                         // 객체 목록이 바뀌면 false
+
+    // 연속 충돌 검사 (보수적 전진)
+    struct CCDHullPair {
+        int hullA;
+        int hullB;
+        Collision::GJKCache cache;                             // 전진 반복 간 GJK 캐시
+    };
+    bool continuousDetection;                                  // 켜면 스윕 AABB와 빠른 쌍의 충돌 시각 계산
+    float timeStep;                                            // 프레임 하나의 시간 (초)
+    std::vector<CCDHullPair> ccdPairs;                         // 중간 단계를 통과한 껍질 쌍 (버퍼는 재사용, 풀이마다 다시 채움)
+
+    // 광선 질의
+    Collision::StaticBVH rayTree;                              // 움직이는 객체 BVH (객체가 움직인 뒤 첫 질의 때 재구축)
+    bool rayTreeDirty;                                         // rayTree/rayTransforms를 다시 만들어야 하는지
+    std::vector<Transform> rayTransforms;                      // objects, staticObjects 순서의 객체 변환
+    std::vector<Transform> rayInverses;                        // 그 역변환 (광선을 객체 로컬로 옮김)
+    std::vector<int> castHulls;                                // 객체 이동 질의에서 스윕 AABB와 겹치는 상대 껍질 버퍼
+
+    bool narrowPhaseLogging;                                   // GJK/SAT 검사마다 요약 한 줄 출력 (디버그용, 기본 꺼짐)
+
 public:
     CollisionManager();
-    ~CollisionManager() = default;
+    ~CollisionManager();
 
     // 객체 관리
     void addObject(Object3D* object);
+    void addStaticObject(Object3D* object);
     void removeObject(Object3D* object);
     void clearObjects();
 
+    // 정적 객체 BVH를 현재 정적 객체들의 AABB로 다시 구축
+    void rebuildStaticTree();
+    void markStaticDirty();
+
+    // 객체가 움직였거나 목록이 바뀌면 다음 광선 질의 때 객체 BVH와 변환 재구축
+    void markRaycastDirty();
+
     // 알고리즘 설정
     void setBroadPhaseAlgorithm(CollisionAlgorithm algorithm);
     void setNarrowPhaseAlgorithm(CollisionAlgorithm algorithm);
     void setCollisionCheckInterval(int interval);
+    void setSpatialHashCellSize(float cellSize);
+    void setPairFilter(const PairFilter& filter);
+    void setNarrowPhaseLogging(bool enabled);
+    void setSleepThreshold(int frames);
+
+    // 연속 충돌 검사: 검사 간격(timeStep * collisionCheckInterval) 동안 객체가 속도대로 움직인다고 보고
+    // 대략적 단계는 그 구간의 스윕 AABB를 쓰고, 이산 검사에서 놓친 빠른 쌍은 보수적 전진으로 충돌 시각을 찾음
+    void setContinuousDetection(bool enabled);
+    bool isContinuousDetection() const;
+    void setTimeStep(float seconds);
+
+    // 휴면 중인 객체와 같은 접촉 섬의 객체를 모두 깨움
+    void wakeObject(Object3D* object);
+    size_t getSleepingCount() const;
+
+    // GJK 반복 통계 (웜 스타트로 줄어든 반복 수 포함)
+    const Collision::GJKStats& getGJKStats() const { return gjkSolver.getStats(); }
+
+    // 두 객체의 현재 접촉 다양체 (충돌 중이 아니면 nullptr)
+    // 법선과 점은 ID가 작은 객체가 A이며, 점마다 프레임 간 유지된 횟수(lifetime)가 있다.
+    const Collision::ContactManifold* getContactManifold(const Object3D* objA, const Object3D* objB);
 
     // 충돌 감지 및 해결
     void update();
 
+    // 광선 질의 (움직이는 객체와 정적 객체 모두, 휴면 객체 포함)
+    // 광선마다 가장 가까운 교차의 객체, 거리, 점, 법선을 hits에 기록 (맞지 않으면 object가 nullptr)
+    // 객체 BVH를 슬랩 검사로 가까운 노드부터 내려가고 후보 객체는 볼록 껍질 면 평면(메시만 있으면 삼각형)으로 검사한다.
+    // 광선들은 OpenMP 스레드에 나눠 처리하며, 시작점이 껍질 안에 있는 광선은 그 껍질을 통과한다.
+    void raycastBatch(const Ray* rays, RayHit* hits, size_t count);
+    bool raycast(const Ray& ray, RayHit& hit);
+
+    // 객체 이동 질의: object의 충돌 형태(껍질 목록, 기본 도형 다면체 또는 메시 볼록체)를 회전 없이
+    // translation만큼 옮길 때 처음 닿는 객체 (객체를 실제로 옮기지 않고 다른 객체도 갱신하지 않음)
+    // 이동 전후를 감싸는 스윕 AABB로 대략적 단계 구조에서 후보를 고르고, 후보 껍질마다 GJK 광선 투사를 한 번씩 실행
+    // 충돌 레이어와 쌍 필터는 충돌 검사와 같게 적용
+    bool shapeCast(Object3D* object, const Vector3& translation, ShapeCastHit& hit);
+
 private:
     // 충돌 감지 단계
     void broadPhase(std::vector<std::pair<Object3D*, Object3D*>>& potentialCollisions);
-    bool narrowPhase(Object3D* objA, Object3D* objB, CollisionInfo& collisionInfo);
+    void bruteForceBroadPhase(std::vector<std::pair<Object3D*, Object3D*>>& potentialCollisions);
+    void linearTreeBroadPhase(std::vector<std::pair<Object3D*, Object3D*>>& potentialCollisions);
+    void spatialHashBroadPhase(std::vector<std::pair<Object3D*, Object3D*>>& potentialCollisions);
+    void refreshWorldBounds();
+    void rebuildBroadPhase();
+    void addToBroadPhase(Object3D* object);
+    void removeFromBroadPhase(Object3D* object);
+    void queryStaticTree(std::vector<std::pair<Object3D*, Object3D*>>& potentialCollisions);
+    bool canCollide(Object3D* objA, Object3D* objB) const;
+    bool isResting(const Object3D* object) const;
+    void updateIslands();
+    int findIsland(int index);
+    void filterPairs(std::vector<std::pair<Object3D*, Object3D*>>& potentialCollisions);
+    bool narrowPhase(Object3D* objA, Object3D* objB, CollisionInfo& collisionInfo, Collision::CollisionPair& pair,
+                     Collision::ContactManifold& manifold);
+    float sweepDuration() const;
+    bool isFastPair(Object3D* objA, Object3D* objB) const;
 
     // 특정 충돌 감지 알고리즘
     bool checkAABBCollision(Object3D* objA, Object3D* objB);
-    bool checkGJKCollision(Object3D* objA, Object3D* objB, CollisionInfo& collisionInfo);
-    bool checkSATCollision(Object3D* objA, Object3D* objB, CollisionInfo& collisionInfo);
+    bool checkGJKCollision(Object3D* objA, Object3D* objB, CollisionInfo& collisionInfo,
+                           Collision::CollisionPair& pair, Collision::ContactManifold& manifold);
+    bool checkSATCollision(Object3D* objA, Object3D* objB, CollisionInfo& collisionInfo,
+                           Collision::CollisionPair& pair, Collision::ContactManifold& manifold);
+    bool checkShapeCollision(Object3D* objA, Object3D* objB, CollisionInfo& collisionInfo,
+                             Collision::ContactManifold& manifold);
+
+    // 보수적 전진 (Conservative Advancement)
+    // GJK 거리와 상대 속도의 법선 성분 상한으로 겹치지 않는 만큼씩 시간을 전진해
+    // 검사 구간 안의 첫 충돌 시각을 찾음 (반복 수 제한)
+    // 구간 동안 가까워질 수 있는 껍질 쌍만 껍질 BVH로 한 번 골라 두고 반복마다 그 쌍들만 거리 질의
+    bool checkTimeOfImpact(Object3D* objA, Object3D* objB, CollisionInfo& collisionInfo,
+                           Collision::ContactManifold& manifold);
+
+    // 광선 질의 헬퍼
+    // prepareRaycast는 객체 변환/AABB 갱신과 BVH 구축을 직렬로 끝내 두므로 traceRay는 읽기만 한다 (스레드 안전).
+    void prepareRaycast();
+    bool traceRay(const Ray& ray, RayHit& hit) const;
+    bool raycastObject(Object3D* object, size_t transformIndex, const RaySlab& ray, float maxDistance,
+                       RayHit& hit) const;
+    void castAgainst(Object3D* object, const Vector3& translation, const AABB& sweptBounds, Object3D* other,
+                     ShapeCastHit& hit);
 
     // GJK 알고리즘 관련 헬퍼 함수
     Vector3 getSupport(Object3D* objA, Object3D* objB, const Vector3& direction);
     bool gjkIntersection(Object3D* objA, Object3D* objB);
     
     // EPA 알고리즘 (충돌 정보 계산)
-    bool epaCalculatePenetration(Object3D* objA, Object3D* objB, 
-                                const std::vector<Vector3>& polytope,
-                                CollisionInfo& collisionInfo);
+    // GJK가 남긴 단순체에서 침투 깊이, A에서 B로 향하는 법선, 접촉점을 계산
+    // 다면체를 만들 수 없는 납작한 접촉이면 false (collisionInfo는 바꾸지 않음)
+    bool epaCalculatePenetration(const ConvexHull& hullA, const Transform& transformA,
+                                 const ConvexHull& hullB, const Transform& transformB,
+                                 const Collision::Simplex& simplex,
+                                 CollisionInfo& collisionInfo,
+                                 Collision::EPAResult& result);
 };
 
 #endif // COLLISION_MANAGER_H
\ No newline at end of file
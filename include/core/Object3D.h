@@ -4,21 +4,34 @@
 #include <vector>
 #include <string>
 #include <functional>
+#include <cstdint>
 #include "Vector3.h"
 #include "Matrix3x3.h"
 #include "Quaternion.h"
+#include "Transform.h"
 #include "AABB.h"
+#include "OBB.h"
+#include "Shape.h"
 #include "ConvexDecomposition.h"
+#include "StaticBVH.h"
 
 class Object3D;
 class CollisionManager;
 
+// 강체 종류
+enum class BodyType {
+    STATIC,     // 움직이지 않음 (정적 BVH에 등록, 정적 객체끼리는 검사하지 않음)
+    KINEMATIC,  // 사용자가 직접 움직이는 객체
+    DYNAMIC     // 시뮬레이션으로 움직이는 객체
+};
+
 class CollisionInfo {
 public:
     Object3D* otherObject;      // 충돌한 다른 객체
     Vector3 contactPoint;       // 충돌 지점
     Vector3 contactNormal;      // 충돌 법선 (이 객체에서 다른 객체 방향)
     float penetrationDepth;     // 침투 깊이
+    float timeOfImpact;         // 연속 충돌 검사로 찾은 충돌 시각 (검사 구간 시작부터 초, 겹쳐 있으면 0)
 
     CollisionInfo();
     CollisionInfo(Object3D* other, const Vector3& point, const Vector3& normal, float depth);
@@ -29,8 +42,22 @@ class Object3D {
         // 충돌 이벤트를 위한 콜백 함수 타입 정의
         using CollisionCallback = std::function<void(const CollisionInfo&)>;
     
+        // CollisionManager에 등록되지 않은 객체의 ID
+        static const uint32_t INVALID_ID = 0xFFFFFFFFu;
+
     private:
         std::string name;           // 객체 이름
+        uint32_t collisionId;       // CollisionManager가 부여하는 ID (쌍 테이블 키)
+        BodyType bodyType;          // 강체 종류
+        CollisionManager* manager;  // 등록된 CollisionManager (없으면 nullptr)
+    
+        // 휴면 상태 (CollisionManager가 관리)
+        bool sleeping;              // 휴면 중이면 변환 갱신과 정밀 검사를 건너뜀
+        bool movedSinceCheck;       // 마지막 충돌 검사 이후 변환이 바뀌었는지
+        int idleFrames;             // 변환이 바뀌지 않은 연속 검사 프레임 수
+        int islandIndex;            // 마지막으로 계산된 접촉 섬 번호 (-1이면 없음)
+        uint32_t collisionCategory; // 이 객체가 속한 충돌 레이어 비트
+        uint32_t collisionMask;     // 충돌할 상대 레이어 비트
     
         // 변환 상태 (위치, 회전, 스케일)
         Vector3 position;           // 위치
@@ -40,9 +67,15 @@ class Object3D {
         Matrix3x3 transformMatrix;  // 변환 행렬
         bool transformDirty;        // 변환 행렬 업데이트 필요 여부
     
+        // 속도 (연속 충돌 검사에서 현재 자세로부터 sweepTime 동안의 움직임)
+        Vector3 linearVelocity;     // 선속도 (월드, 초당 거리)
+        Vector3 angularVelocity;    // 각속도 (월드 축, 초당 라디안, 위치를 중심으로 회전)
+        float sweepTime;            // 월드 AABB에 포함할 이동 시간 (CollisionManager가 설정, 0이면 현재 자세만)
+    
         AABB localAABB;             // 로컬 좌표계 AABB
         AABB worldAABB;             // 월드 좌표계 AABB
         bool aabbDirty;             // AABB 업데이트 필요 여부
+        OBB localOBB;               // 로컬 좌표계의 조밀한 OBB (메시/껍질 로드 시 계산)
     
         bool isInCollision;         // 충돌 상태 여부
         std::vector<CollisionInfo> collisions;  // 현재 충돌 정보 리스트
@@ -51,10 +84,17 @@ class Object3D {
         std::vector<Vector3> vertices;  // 정점 배열
         std::vector<Vector3> normals;   // 법선 배열
         std::vector<int> indices;       // 인덱스 배열
+        ConvexHull meshHull;            // 메시 정점으로 만든 볼록체 (분해되지 않은 객체의 GJK용)
+    
+        // 충돌 형태 (기본 도형이면 닫힌 식 검사, 닫힌 식이 없는 쌍은 shapeHull로 GJK/SAT)
+        Shape shape;
+        ConvexHull shapeHull;           // 기본 도형의 볼록 다면체
     
         // 볼록 분해 결과
         std::vector<ConvexHull> convexHulls;  // 볼록 껍질 배열
         bool isConvexDecomposed;              // 볼록 분해 완료 여부
+        std::vector<AABB> hullBounds;         // 껍질별 로컬 AABB
+        Collision::StaticBVH hullTree;        // hullBounds로 만든 껍질 BVH (분해된 객체끼리의 중간 단계 검사)
     
         // 충돌 이벤트 콜백
         CollisionCallback onCollisionEnter;  // 충돌 시작 시 호출
@@ -84,15 +124,58 @@ class Object3D {
         void setScale(const Vector3& s);
         void setScale(float uniformScale);
     
+        // 강체 종류 (등록된 객체의 종류를 바꾸면 관리자의 정적/움직이는 목록 사이를 옮김)
+        void setBodyType(BodyType type);
+        BodyType getBodyType() const;
+    
+        // 휴면 상태 (setPosition/setRotation/translate 등으로 변환을 바꾸면 접촉 섬 전체가 깨어남)
+        bool isSleeping() const;
+        void wakeUp();
+    
+        // 속도 (0이 아닌 속도를 주면 휴면 중이어도 깨어남)
+        void setLinearVelocity(const Vector3& velocity);
+        void setAngularVelocity(const Vector3& velocity);
+        const Vector3& getLinearVelocity() const;
+        const Vector3& getAngularVelocity() const;
+        bool hasVelocity() const;
+    
         // 변환 행렬 연산
         const Matrix3x3& getTransformMatrix();
+        Transform getTransform();
+        // 현재 자세에서 속도대로 time초 움직인 변환 (회전은 위치를 중심으로)
+        Transform getTransformAt(float time);
+        // 위치에서 로컬 AABB 꼭짓점까지의 최대 거리 (스케일 포함, 회전해도 변하지 않는 경계 반지름)
+        float getBoundingRadius() const;
         void updateTransformMatrix();
     
         // AABB 연산
         void setLocalAABB(const AABB& aabb);
         const AABB& getLocalAABB() const;
+        // 월드 AABB (sweepTime이 있으면 그동안 지나가는 영역까지 포함한 스윕 AABB)
         const AABB& getAABB();
         void updateWorldAABB();
+
+        // OBB 연산 (SAT 정밀 검사용)
+        const OBB& getLocalOBB() const;
+        OBB getOBB();
+    
+        // 충돌 형태 (로컬 좌표계, 기본값은 HULL)
+        // 기본 도형을 지정하면 로컬 AABB/OBB가 도형을 감싸도록 바뀌고, 닫힌 식이 있는 쌍은 메시/껍질 대신 도형으로 검사한다.
+        void setSphereShape(float radius, const Vector3& center = Vector3(0, 0, 0));
+        void setCapsuleShape(float radius, float halfHeight, const Vector3& axis = Vector3(0, 1, 0),
+                             const Vector3& center = Vector3(0, 0, 0));
+        void setBoxShape(const Vector3& halfExtents, const Vector3& center = Vector3(0, 0, 0),
+                         const Matrix3x3& orientation = Matrix3x3());
+        // 메시(분해된 경우 껍질) 정점을 감싸는 type 도형으로 설정, 정점이 없으면 false
+        bool fitShape(ShapeType type);
+        // 메시/껍질 형태로 되돌림
+        void setHullShape();
+        const Shape& getShape() const;
+        ShapeType getShapeType() const;
+        // 현재 변환을 적용한 도형 (비균등 스케일이면 구/캡슐 반지름은 가장 큰 스케일 축 기준)
+        WorldShape getWorldShape();
+        // 분해되지 않은 경로의 단일 볼록체 (기본 도형이면 도형 다면체, 아니면 메시 정점)
+        const ConvexHull& getCollisionHull() const;
     
         // 변환 연산
         Vector3 transformPoint(const Vector3& point);
@@ -104,9 +187,20 @@ class Object3D {
         bool isColliding() const;
         const std::vector<CollisionInfo>& getCollisions() const;
         void addCollision(const CollisionInfo& collision);
+        void updateCollision(const CollisionInfo& collision);
         void removeCollision(Object3D* other);
         void clearCollisions();
     
+        // 충돌 레이어 필터 (두 객체 모두 상대 카테고리를 마스크에 포함해야 충돌 검사)
+        void setCollisionCategory(uint32_t category);
+        void setCollisionMask(uint32_t mask);
+        uint32_t getCollisionCategory() const;
+        uint32_t getCollisionMask() const;
+        bool shouldCollideWith(const Object3D& other) const {
+            return (collisionCategory & other.collisionMask) != 0 &&
+                   (other.collisionCategory & collisionMask) != 0;
+        }
+    
         // 충돌 이벤트 콜백 설정
         void setOnCollisionEnter(const CollisionCallback& callback);
         void setOnCollisionStay(const CollisionCallback& callback);
@@ -127,18 +221,40 @@ class Object3D {
     
         // GJK/EPA 알고리즘용 지원 함수
         Vector3 getSupportPoint(const Vector3& direction) const;
+        const ConvexHull& getMeshHull() const;
     
         // 접근자
         bool isDecomposed() const;
         const std::vector<ConvexHull>& getConvexHulls() const;
+        const std::vector<AABB>& getHullBounds() const;
+        const Collision::StaticBVH& getHullTree() const;
         const std::vector<Vector3>& getVertices() const;
         const std::vector<Vector3>& getNormals() const;
         const std::vector<int>& getIndices() const;
         const std::string& getName() const;
+        uint32_t getCollisionId() const;
         void setName(const std::string& _name);
     
         // 업데이트 메서드
         void update();
+    
+    private:
+        void markTransformChanged();
+
+        // 껍질별 로컬 AABB와 껍질 BVH를 만들고 전체 로컬 AABB를 그 합으로 설정
+        void buildHullTree();
+
+        // 껍질 정점(분해된 경우) 또는 메시 정점으로 로컬 OBB 계산
+        void buildLocalOBB();
+
+        // 분해된 경우 모든 껍질, 아니면 메시의 정점과 삼각형 인덱스
+        void collectPoints(std::vector<Vector3>& points, std::vector<int>& triangles) const;
+
+        // 기본 도형으로 로컬 AABB/OBB와 도형 다면체를 다시 계산
+        void applyShape();
+
+        // 로컬 OBB에 현재 회전과 스케일 적용
+        OBB toWorldOBB(const OBB& local);
     };
     
     #endif // OBJECT3D_H
@@ -3,12 +3,34 @@
 
 #include <vector>
 #include "Vector3.h"
+#include "Transform.h"
+
+// 동일 평면 삼각형을 합친 볼록 껍질의 면 (다각형)
+struct HullFace {
+    Vector3 normal;         // 바깥 방향 단위 법선 (로컬)
+    float offset;           // 평면 normal · x = offset
+    int firstVertex;        // faceVertices에서 이 면의 꼭짓점이 시작하는 위치
+    int vertexCount;        // 법선 쪽에서 볼 때 반시계 방향 꼭짓점 수
+};
+
+// 서로 다른 두 면이 만나는 볼록 껍질의 변
+struct HullEdge {
+    int v0;
+    int v1;
+    int face0;              // 변에 붙은 두 면
+    int face1;
+};
 
 // 볼록 껍질 클래스 (단일 볼록 메시를 나타냄)
 class ConvexHull {
 public:
     std::vector<Vector3> vertices;  // 볼록 껍질의 정점 배열
     std::vector<int> indices;       // 면 인덱스 배열 (각 3개의 인덱스가 하나의 삼각형을 정의)
+    std::vector<int> adjacencyStart; // 정점별 이웃 목록 시작 위치 (CSR, 정점 수 + 1개)
+    std::vector<int> adjacency;      // 모든 정점의 이웃 정점 인덱스
+    std::vector<HullFace> faces;     // 면 다각형 (SAT 면 축, 접촉 다각형 자르기)
+    std::vector<int> faceVertices;   // 모든 면의 꼭짓점 인덱스
+    std::vector<HullEdge> edges;     // 면 사이 변 (SAT 변 쌍 축)
     
     // 기본 생성자
     ConvexHull() {}
@@ -34,6 +56,35 @@ public:
 
     // 특정 방향에 최대로 멀리있는 점
     Vector3 support(const Vector3& direction) const;
+
+    // 특정 방향에 최대로 멀리있는 정점의 인덱스 (정점이 없으면 -1)
+    int supportIndex(const Vector3& localDirection) const;
+
+    // indices의 삼각형 변으로 정점 인접 목록 구성 (인덱스가 잘못되면 인접 정보 없음)
+    // 실제 볼록 껍질에만 사용 (오목한 메시에서는 언덕 오르기가 국소 최대에서 멈춤)
+    void buildAdjacency();
+    bool hasAdjacency() const { return !adjacencyStart.empty(); }
+
+    // indices의 삼각형 중 같은 평면에 있는 것을 하나의 면으로 합치고 면 사이 변을 구성
+    // 법선은 정점 중심에서 바깥을 향하도록 맞추므로 삼각형 감김 방향과 무관하다.
+    void buildFeatures();
+    bool hasFeatures() const { return !faces.empty(); }
+
+    // startVertex에서 시작해 더 먼 이웃으로 옮겨 가는 언덕 오르기 지원점 탐색
+    // 인접 정보가 없거나 시작 정점이 유효하지 않으면 전체 정점 탐색
+    int supportIndex(const Vector3& localDirection, int startVertex) const;
+
+    // transform이 적용된 껍질의 월드 지원점
+    // 방향을 한 번만 로컬로 바꿔 탐색하고 선택된 정점 하나만 월드로 변환
+    Vector3 support(const Vector3& worldDirection, const Transform& transform) const;
+
+    // 위와 같지만 cachedVertex에서 언덕 오르기를 시작하고 찾은 정점으로 갱신
+    Vector3 support(const Vector3& worldDirection, const Transform& transform, int& cachedVertex) const;
+
+    // 로컬 광선 origin + t * direction (0 <= t <= maxDistance)과 면 평면들의 교차 (Cyrus-Beck)
+    // 들어가는 t 중 가장 큰 값과 나가는 t 중 가장 작은 값을 좁혀 가며, 맞으면 t와 들어간 면 번호를 기록
+    // 면 정보(buildFeatures)가 없거나 원점이 껍질 안에 있으면 false
+    bool raycast(const Vector3& origin, const Vector3& direction, float maxDistance, float& t, int& face) const;
 };
 
 #endif // CONVEXHULL_H
\ No newline at end of file
@@ -47,6 +47,12 @@ public:
         return size.x * size.y * size.z;
     }
 
+    // 표면적 반환 (BVH 비용 계산용)
+    float getSurfaceArea() const {
+        Vector3 size = getSize();
+        return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+    }
+
     // 다른 AABB와 교차 여부 확인
     bool intersects(const AABB& other) const {
         return (min.x <= other.max.x && max.x >= other.min.x) &&
@@ -0,0 +1,66 @@
+#ifndef AABB_SOA_H
+#define AABB_SOA_H
+
+#include "AABB.h"
+#include "Ray.h"
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+// AABB 배열의 구조체-배열(SoA) 저장소
+// 축마다 min/max를 별도의 float 배열로 보관해 한 AABB를 여러 AABB와 SIMD로 한 번에 검사한다.
+// 배열 끝은 빈 AABB로 채워 두므로 어느 위치에서든 LANES개를 읽어도 범위를 벗어나지 않는다.
+class AABBSoA {
+public:
+    static const size_t LANES = 8;      // AVX 한 번에 검사하는 AABB 수 (SSE는 4)
+
+    std::vector<float> minX, minY, minZ;
+    std::vector<float> maxX, maxY, maxZ;
+
+    AABBSoA() : count(0) {}
+
+    // 크기 변경 (새 칸과 패딩은 빈 AABB)
+    void resize(size_t n);
+    void clear() { resize(0); }
+    size_t size() const { return count; }
+
+    void set(size_t i, const AABB& aabb) {
+        minX[i] = aabb.min.x; minY[i] = aabb.min.y; minZ[i] = aabb.min.z;
+        maxX[i] = aabb.max.x; maxY[i] = aabb.max.y; maxZ[i] = aabb.max.z;
+    }
+
+    // i번째 칸을 어떤 AABB와도 겹치지 않는 빈 AABB로 설정
+    void setEmpty(size_t i);
+
+    AABB get(size_t i) const {
+        return AABB(Vector3(minX[i], minY[i], minZ[i]), Vector3(maxX[i], maxY[i], maxZ[i]));
+    }
+
+    bool overlaps(size_t i, size_t j) const {
+        return (minX[i] <= maxX[j] && maxX[i] >= minX[j]) &&
+               (minY[i] <= maxY[j] && maxY[i] >= minY[j]) &&
+               (minZ[i] <= maxZ[j] && maxZ[i] >= minZ[j]);
+    }
+
+    bool overlaps(size_t i, const AABB& aabb) const {
+        return (minX[i] <= aabb.max.x && maxX[i] >= aabb.min.x) &&
+               (minY[i] <= aabb.max.y && maxY[i] >= aabb.min.y) &&
+               (minZ[i] <= aabb.max.z && maxZ[i] >= aabb.min.z);
+    }
+
+    // query와 [begin, end) 범위의 AABB를 SIMD로 검사해 겹치는 인덱스를 out에 기록
+    // out은 최소 end - begin개를 담을 수 있어야 하며, 기록한 개수를 반환
+    size_t overlapBatch(const AABB& query, size_t begin, size_t end, uint32_t* out) const;
+
+    // 광선과 [begin, end) 범위의 AABB를 SIMD 슬랩 검사로 검사해 [0, maxDistance]에서 만나는 인덱스를 out에 기록
+    // out은 최소 end - begin개를 담을 수 있어야 하며, 기록한 개수를 반환
+    size_t raycastBatch(const RaySlab& ray, float maxDistance, size_t begin, size_t end, uint32_t* out) const;
+
+    // 컴파일된 SIMD 경로 이름 ("AVX", "SSE", "scalar")
+    static const char* simdPath();
+
+private:
+    size_t count;
+};
+
+#endif // AABB_SOA_H
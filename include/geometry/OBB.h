@@ -8,6 +8,8 @@
 #include <vector>
 #include <array>
 #include <cmath>  // std::abs
+#include <cstddef>
+#include <cstdint>
 
 class OBB {
 public:
@@ -91,56 +93,24 @@ public:
                 std::abs(localPoint.z) <= halfExtents.z);
     }
 
-    // 분리 축 정리(SAT)을 통해 두 OBB가 교차하는지 검사
-    bool intersects(const OBB& other) const {
-        std::array<Vector3, 3> axesA = getAxes();
-        std::array<Vector3, 3> axesB = other.getAxes();
-        Vector3 t = other.center - center;
-        
-        // A의 축에 대해 검사
-        for (int i = 0; i < 3; i++) {
-            if (!overlapOnAxis(other, axesA[i], t))
-                return false;
-        }
-        // B의 축에 대해 검사
-        for (int i = 0; i < 3; i++) {
-            if (!overlapOnAxis(other, axesB[i], t))
-                return false;
-        }
-        // 두 축의 외적으로 만들어진 분리 축에 대해 검사
-        for (int i = 0; i < 3; i++) {
-            for (int j = 0; j < 3; j++) {
-                Vector3 axis = axesA[i].cross(axesB[j]);
-                if (axis.dot(axis) < 1e-6f)  // 벡터의 길이 제곱 검사
-                    continue;
-                axis.normalize();
-                if (!overlapOnAxis(other, axis, t))
-                    return false;
-            }
-        }
-        return true;
-    }
+    // 분리 축 정리(SAT)로 두 OBB가 교차하는지 검사 (Gottschalk 방식)
+    // R = Aᵀ·B와 |R| + ε를 한 번만 계산하고 15개 축을 닫힌 식으로 검사하며, 분리 축을 찾는 즉시 종료한다.
+    // orientation은 정규 직교 회전 행렬이어야 한다 (스케일은 halfExtents에 반영).
+    bool intersects(const OBB& other) const;
+
+    // 이 OBB와 others[0..count) 각각을 검사해 겹치는 인덱스를 out에 기록하고 개수 반환
+    // 이 OBB의 축과 중심은 한 번만 읽어 두고 모든 상대에 재사용한다.
+    size_t intersectsBatch(const OBB* others, size_t count, uint32_t* out) const;
 
     // 정적 함수: 최소 좌표와 최대 좌표로부터 AABB를 만들고, 이를 이용해 OBB 생성
     static OBB fromAABB(const Vector3& min, const Vector3& max);
 
-private:
-    // 주어진 축(axis)에 대해 현재 OBB와 다른 OBB가 겹치는지 검사
-    bool overlapOnAxis(const OBB& other, const Vector3& axis, const Vector3& t) const {
-        float ra = projectExtent(axis);
-        float rb = other.projectExtent(axis);
-        float t_projection = std::abs(t.dot(axis));
-        return t_projection <= (ra + rb);
-    }
+    // 정적 함수: 점 집합을 조밀하게 감싸는 OBB
+    // 공분산 행렬의 고유 벡터(PCA) 축으로 시작해, triangleIndices 삼각형의 면 법선(볼록 껍질이면 껍질 면)을
+    // 한 축으로 하는 후보 좌표계와 좌표축 정렬 상자까지 비교하여 표면적이 가장 작은 상자를 고른다.
+    // 좌표축 상자도 후보이므로 결과는 점 집합의 AABB보다 크지 않다.
+    static OBB fitPoints(const std::vector<Vector3>& points, const std::vector<int>& triangleIndices);
 
-    // 주어진 축(axis)에 대해, 현재 OBB의 투영(반 길이) 합산
-    float projectExtent(const Vector3& axis) const {
-        std::array<Vector3, 3> axes = getAxes();
-        // halfExtents의 각 축값과 해당 방향 벡터를 곱해 dot 연산으로 투영 길이 계산
-        return std::abs((this->halfExtents.x * axes[0]).dot(axis)) +
-               std::abs((this->halfExtents.y * axes[1]).dot(axis)) +
-               std::abs((this->halfExtents.z * axes[2]).dot(axis));
-    }
 };
 
 #endif // OBB_H
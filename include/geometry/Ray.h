@@ -0,0 +1,63 @@
+#ifndef RAY_H
+#define RAY_H
+
+#include "../math/Vector3.h"
+#include "AABB.h"
+#include <limits>
+#include <algorithm>
+#include <cstdint>
+#include <cmath>
+
+// 광선 (origin + t * direction, 0 <= t <= maxDistance)
+struct Ray {
+    Vector3 origin;
+    Vector3 direction;      // 길이는 상관없음 (질의할 때 정규화하므로 t는 거리)
+    float maxDistance;
+    uint32_t mask;          // 검사할 충돌 카테고리 비트 (객체 카테고리와 겹치지 않으면 건너뜀)
+
+    Ray() : direction(0, 0, 1), maxDistance(std::numeric_limits<float>::max()), mask(0xFFFFFFFFu) {}
+    Ray(const Vector3& origin, const Vector3& direction,
+        float maxDistance = std::numeric_limits<float>::max(), uint32_t mask = 0xFFFFFFFFu)
+        : origin(origin), direction(direction), maxDistance(maxDistance), mask(mask) {}
+};
+
+// 슬랩 검사용 광선 (방향 역수와 부호를 한 번만 계산)
+// 방향 성분이 0이면 역수가 ±무한대가 되고, 원점이 그 축의 슬랩 경계 위에 있어 생기는 NaN은
+// 누적값을 첫 인자로 둔 min/max 순서로 무시한다.
+struct RaySlab {
+    Vector3 origin;
+    Vector3 direction;
+    Vector3 invDirection;
+    bool negative[3];       // 방향 역수가 음수인 축 (가까운 쪽 슬랩이 max, -0도 포함)
+
+    RaySlab(const Vector3& origin, const Vector3& direction)
+        : origin(origin), direction(direction),
+          invDirection(1.0f / direction.x, 1.0f / direction.y, 1.0f / direction.z) {
+        // -0의 역수는 -무한대이므로 비교(< 0)가 아니라 부호 비트로 판단해야 가까운/먼 슬랩이 뒤바뀌지 않음
+        negative[0] = std::signbit(direction.x);
+        negative[1] = std::signbit(direction.y);
+        negative[2] = std::signbit(direction.z);
+    }
+
+    // [0, maxDistance] 구간에서 상자와 만나면 상자에 들어가는 t를 tEntry에 기록
+    bool intersect(const Vector3& boxMin, const Vector3& boxMax, float maxDistance, float& tEntry) const {
+        float tMin = 0.0f;
+        float tMax = maxDistance;
+
+        tMin = std::max(tMin, ((negative[0] ? boxMax.x : boxMin.x) - origin.x) * invDirection.x);
+        tMax = std::min(tMax, ((negative[0] ? boxMin.x : boxMax.x) - origin.x) * invDirection.x);
+        tMin = std::max(tMin, ((negative[1] ? boxMax.y : boxMin.y) - origin.y) * invDirection.y);
+        tMax = std::min(tMax, ((negative[1] ? boxMin.y : boxMax.y) - origin.y) * invDirection.y);
+        tMin = std::max(tMin, ((negative[2] ? boxMax.z : boxMin.z) - origin.z) * invDirection.z);
+        tMax = std::min(tMax, ((negative[2] ? boxMin.z : boxMax.z) - origin.z) * invDirection.z);
+
+        tEntry = tMin;
+        return tMin <= tMax;
+    }
+
+    bool intersect(const AABB& box, float maxDistance, float& tEntry) const {
+        return intersect(box.min, box.max, maxDistance, tEntry);
+    }
+};
+
+#endif // RAY_H
@@ -0,0 +1,70 @@
+#ifndef SHAPE_H
+#define SHAPE_H
+
+#include "../math/Vector3.h"
+#include "../math/Matrix3x3.h"
+#include "../decomposition/ConvexHull.h"
+#include "AABB.h"
+#include "OBB.h"
+#include <vector>
+
+// 객체의 충돌 형태
+// HULL은 메시/볼록 분해 껍질을 그대로 쓰고, 나머지는 닫힌 식 검사가 가능한 기본 도형
+enum class ShapeType {
+    HULL,       // 메시 정점 또는 볼록 분해 껍질
+    SPHERE,     // 구
+    CAPSULE,    // 캡슐 (선분 + 반지름)
+    BOX,        // 상자
+    COUNT
+};
+
+// 월드 좌표계의 기본 도형 (Object3D::getWorldShape)
+struct WorldShape {
+    ShapeType type;
+    Vector3 center;         // 구 중심 / 캡슐 선분 중점
+    Vector3 axis;           // 캡슐 선분 방향 (단위 벡터)
+    float halfHeight;       // 캡슐 선분 절반 길이
+    float radius;           // 구/캡슐 반지름
+    OBB box;                // 상자
+
+    WorldShape() : type(ShapeType::HULL), axis(0, 1, 0), halfHeight(0.0f), radius(0.0f) {}
+
+    // 캡슐 선분 양 끝
+    Vector3 segmentStart() const { return center - axis * halfHeight; }
+    Vector3 segmentEnd() const { return center + axis * halfHeight; }
+};
+
+// 객체 로컬 좌표계의 충돌 형태
+class Shape {
+public:
+    ShapeType type;
+    Vector3 center;         // 구 중심 / 캡슐 선분 중점
+    Vector3 axis;           // 캡슐 선분 방향 (단위 벡터)
+    float halfHeight;       // 캡슐 선분 절반 길이
+    float radius;           // 구/캡슐 반지름
+    OBB box;                // 상자 (중심, 반 크기, 회전)
+
+    Shape() : type(ShapeType::HULL), center(0, 0, 0), axis(0, 1, 0), halfHeight(0.0f), radius(0.0f) {}
+
+    static Shape createSphere(float radius, const Vector3& center);
+    static Shape createCapsule(float radius, float halfHeight, const Vector3& axis, const Vector3& center);
+    static Shape createBox(const Vector3& halfExtents, const Vector3& center, const Matrix3x3& orientation);
+
+    // 점 집합을 감싸는 type 도형
+    // 상자는 OBB::fitPoints, 구는 그 상자 중심에서 가장 먼 점까지, 캡슐은 상자의 가장 긴 축을 선분 방향으로 하여
+    // 모든 점을 포함하는 가장 작은 반지름과 선분 길이를 고른다.
+    static Shape fit(ShapeType type, const std::vector<Vector3>& points, const std::vector<int>& triangleIndices);
+
+    bool isPrimitive() const { return type != ShapeType::HULL; }
+
+    // 도형을 감싸는 로컬 AABB / OBB
+    AABB localBounds() const;
+    OBB boundingBox() const;
+
+    // 닫힌 식이 없는 쌍(GJK/EPA, 다면체 SAT)에 쓰는 볼록 다면체
+    // 상자는 여덟 꼭짓점 그대로, 구/캡슐은 위도/경도로 나눈 외접 다면체 (면/변/인접 정보 포함)
+    // 외접 다면체는 어느 방향으로도 도형보다 짧지 않으므로 접촉을 놓치거나 침투를 얕게 보고하지 않는다.
+    ConvexHull buildHull() const;
+};
+
+#endif // SHAPE_H
@@ -0,0 +1,39 @@
+#ifndef TRANSFORM_H
+#define TRANSFORM_H
+
+#include "Vector3.h"
+#include "Matrix3x3.h"
+
+// 강체 변환 (월드 점 = basis * 로컬 점 + position)
+// basis는 회전 행렬의 각 열에 축별 스케일을 곱한 행렬(R * S)
+class Transform {
+public:
+    Matrix3x3 basis;
+    Vector3 position;
+
+    Transform();
+    Transform(const Matrix3x3& basis, const Vector3& position);
+
+    // 로컬 점을 월드 좌표로 변환
+    Vector3 transformPoint(const Vector3& localPoint) const;
+
+    // 월드 방향 d를 basis의 전치로 변환 (S * R^T * d)
+    // dot(d, basis * v) == dot(basis^T * d, v) 이므로 로컬 정점에서 지원점을 찾을 때의 탐색 방향
+    Vector3 transposeDirection(const Vector3& worldDir) const;
+
+    // 로컬 면 법선을 월드 법선 방향으로 옮기는 행렬 (basis의 여인수 행렬, 반사 변환이면 부호 반전)
+    // 역전치 행렬에 |행렬식|을 곱한 것과 같아 비균등 스케일에도 면에 수직이며, 결과는 정규화해서 사용
+    Matrix3x3 normalMatrix() const;
+
+    // 역변환 (basis가 특이 행렬이면 단위 변환)
+    // Matrix3x3::inverse와 달리 행렬식 허용값이 없어 작은 스케일도 그대로 역변환한다.
+    Transform inverse() const;
+
+    // 합성 변환: (this * other)(p) = this(other(p))
+    Transform operator*(const Transform& other) const;
+
+    static Transform identity();
+    static Transform translation(const Vector3& position);
+};
+
+#endif // TRANSFORM_H
@@ -1,137 +1,397 @@
-// #include "collision/BVH.h"
-// #include <limits>
-
-// namespace Collision {
-
-// void BVH::rebuild() {
-//     if (objects.empty()) {
-//         root = nullptr;
-//         return;
-//     }
-
-//     // 모든 객체의 AABB를 최신 상태로 업데이트 (객체 내부에서 isDirty 플래그에 따라)
-//     for (auto obj : objects) {
-//         if (obj->isDirty) {
-//             obj->updateBoundingVolumes();
-//         }
-//     }
-
-//     // 객체 목록의 복사본을 사용하여 루트 노드를 재구성
-//     std::vector<Core::Object3D*> objectsCopy = objects;
-//     root = buildNode(objectsCopy, 0);
-// }
-
-// std::shared_ptr<BVHNode> BVH::buildNode(std::vector<Core::Object3D*>& nodeObjects, int depth) {
-//     auto node = std::make_shared<BVHNode>();
-
-//     // 해당 노드의 AABB: 포함하는 모든 객체들의 AABB를 합친 것
-//     node->aabb = AABB();
-//     for (auto obj : nodeObjects) {
-//         node->aabb.expand(obj->getAABB());
-//     }
-
-//     // 종료 조건: 객체가 1개 또는 최대 재귀 깊이에 도달하면 리프 노드로 처리
-//     const int MAX_DEPTH = 20;
-//     if (nodeObjects.size() == 1 || depth >= MAX_DEPTH) {
-//         if (!nodeObjects.empty()) {
-//             node->object = nodeObjects[0];
-//         }
-//         return node;
-//     }
-
-//     // 분할 축 선택: AABB 크기에서 가장 긴 축을 선택 (x:0, y:1, z:2)
-//     Vector3 size = node->aabb.getSize();
-//     int axis = 0;
-//     if (size.y > size.x && size.y > size.z) {
-//         axis = 1;
-//     } else if (size.z > size.x && size.z > size.y) {
-//         axis = 2;
-//     }
-
-//     // 선택한 축에 따라 분할할 위치(중심)
-//     Vector3 center = node->aabb.getCenter();
-//     float splitPos = (axis == 0) ? center.x : ((axis == 1) ? center.y : center.z);
-
-//     // 객체들을 좌우로 분할
-//     std::vector<Core::Object3D*> leftObjects, rightObjects;
-//     for (auto obj : nodeObjects) {
-//         Vector3 objCenter = obj->getAABB().getCenter();
-//         float objPos = (axis == 0) ? objCenter.x : ((axis == 1) ? objCenter.y : objCenter.z);
-//         if (objPos < splitPos) {
-//             leftObjects.push_back(obj);
-//         } else {
-//             rightObjects.push_back(obj);
-//         }
-//     }
-
-//     // 한쪽에만 몰리는 경우 단순 분할 (중간값 기준)
-//     if (leftObjects.empty() || rightObjects.empty()) {
-//         size_t mid = nodeObjects.size() / 2;
-//         leftObjects.clear();
-//         rightObjects.clear();
-//         for (size_t i = 0; i < nodeObjects.size(); i++) {
-//             if (i < mid)
-//                 leftObjects.push_back(nodeObjects[i]);
-//             else
-//                 rightObjects.push_back(nodeObjects[i]);
-//         }
-//     }
-
-//     // 재귀적으로 왼쪽, 오른쪽 자식 노드 생성
-//     node->left = buildNode(leftObjects, depth + 1);
-//     node->right = buildNode(rightObjects, depth + 1);
-
-//     return node;
-// }
-
-// void BVH::findCollisions(std::shared_ptr<BVHNode> nodeA, std::shared_ptr<BVHNode> nodeB,
-//     std::vector<std::pair<Core::Object3D*, Core::Object3D*>>& collisionPairs)
-// {
-//     // 두 노드의 AABB가 교차하지 않으면 바로 리턴
-//     if (!nodeA->aabb.intersects(nodeB->aabb))
-//         return;
-
-//     // 두 노드 모두 리프인 경우 충돌 가능한 객체 쌍 추가 (자기 자신 제외)
-//     if (nodeA->isLeaf() && nodeB->isLeaf()) {
-//         if (nodeA->object == nodeB->object)
-//             return;
-//         collisionPairs.push_back(std::make_pair(nodeA->object, nodeB->object));
-//         return;
-//     }
-
-//     // 한쪽이 리프이면 자식 노드와 비교
-//     if (nodeA->isLeaf()) {
-//         findCollisions(nodeA, nodeB->left, collisionPairs);
-//         findCollisions(nodeA, nodeB->right, collisionPairs);
-//         return;
-//     }
-//     if (nodeB->isLeaf()) {
-//         findCollisions(nodeA->left, nodeB, collisionPairs);
-//         findCollisions(nodeA->right, nodeB, collisionPairs);
-//         return;
-//     }
-
-//     // 두 노드 모두 내부 노드이면 자식끼리 4분할하여 비교
-//     findCollisions(nodeA->left, nodeB->left, collisionPairs);
-//     findCollisions(nodeA->left, nodeB->right, collisionPairs);
-//     findCollisions(nodeA->right, nodeB->left, collisionPairs);
-//     findCollisions(nodeA->right, nodeB->right, collisionPairs);
-// }
-
-// std::vector<std::pair<Core::Object3D*, Core::Object3D*>> BVH::findCollisionPairs() {
-//     std::vector<std::pair<Core::Object3D*, Core::Object3D*>> collisionPairs;
-//     if (!root || objects.size() < 2)
-//         return collisionPairs;
-
-//     // 객체들의 AABB를 다시 업데이트 (필요한 경우)
-//     for (auto obj : objects) {
-//         if (obj->isDirty) {
-//             obj->updateBoundingVolumes();
-//         }
-//     }
-
-//     findCollisions(root, root, collisionPairs);
-//     return collisionPairs;
-// }
-
-// } // namespace Collision
\ No newline at end of file
+#include "collision/BVH.h"
+#include <algorithm>
+
+namespace Collision {
+
+BVH::BVH(float fatMargin)
+    : root(NULL_NODE), freeList(NULL_NODE), fatMargin(fatMargin) {
+}
+
+// 빈 노드 목록에서 노드를 꺼내거나 배열 끝에 새 노드를 추가
+int BVH::allocateNode() {
+    int node;
+    if (freeList != NULL_NODE) {
+        node = freeList;
+        freeList = nodes[node].parent;
+    } else {
+        node = static_cast<int>(nodes.size());
+        nodes.push_back(BVHNode());
+    }
+
+    nodes[node] = BVHNode();
+    nodes[node].height = 0;
+    return node;
+}
+
+// 노드를 빈 노드 목록으로 반환
+void BVH::freeNode(int node) {
+    nodes[node].object = nullptr;
+    nodes[node].height = -1;
+    nodes[node].parent = freeList;
+    freeList = node;
+}
+
+// 월드 AABB를 여유 폭만큼 확장
+AABB BVH::fatten(const AABB& aabb) const {
+    Vector3 margin(fatMargin, fatMargin, fatMargin);
+    return AABB(aabb.min - margin, aabb.max + margin);
+}
+
+void BVH::addObject(Object3D* object) {
+    if (object == nullptr || objectToLeaf.count(object)) {
+        return;
+    }
+
+    int leaf = allocateNode();
+    nodes[leaf].object = object;
+    nodes[leaf].aabb = fatten(object->getAABB());
+    objectToLeaf[object] = leaf;
+
+    insertLeaf(leaf);
+}
+
+void BVH::removeObject(Object3D* object) {
+    auto it = objectToLeaf.find(object);
+    if (it == objectToLeaf.end()) {
+        return;
+    }
+
+    int leaf = it->second;
+    objectToLeaf.erase(it);
+
+    removeLeaf(leaf);
+    freeNode(leaf);
+}
+
+// 월드 AABB가 아직 fat AABB 안에 있으면 트리를 그대로 둠
+bool BVH::updateObject(Object3D* object) {
+    auto it = objectToLeaf.find(object);
+    if (it == objectToLeaf.end()) {
+        return false;
+    }
+
+    int leaf = it->second;
+    const AABB& aabb = object->getAABB();
+    if (nodes[leaf].aabb.contains(aabb)) {
+        return false;
+    }
+
+    // 같은 리프 노드를 떼어냈다가 새 fat AABB로 다시 삽입
+    removeLeaf(leaf);
+    nodes[leaf].aabb = fatten(aabb);
+    insertLeaf(leaf);
+    return true;
+}
+
+void BVH::update() {
+    for (const auto& entry : objectToLeaf) {
+        updateObject(entry.first);
+    }
+}
+
+void BVH::clear() {
+    nodes.clear();
+    objectToLeaf.clear();
+    pairStack.clear();
+    root = NULL_NODE;
+    freeList = NULL_NODE;
+}
+
+// 표면적 증가량이 가장 작은 형제 노드를 찾아 리프 삽입
+void BVH::insertLeaf(int leaf) {
+    if (root == NULL_NODE) {
+        root = leaf;
+        nodes[root].parent = NULL_NODE;
+        return;
+    }
+
+    const AABB leafAABB = nodes[leaf].aabb;
+    int index = root;
+
+    while (!nodes[index].isLeaf()) {
+        int left = nodes[index].left;
+        int right = nodes[index].right;
+
+        float area = nodes[index].aabb.getSurfaceArea();
+        float combinedArea = nodes[index].aabb.merge(leafAABB).getSurfaceArea();
+
+        // 현재 노드에 새 부모를 만들어 붙이는 비용
+        float cost = 2.0f * combinedArea;
+
+        // 자식으로 내려갈 때 조상들이 부담하는 최소 비용
+        float inheritanceCost = 2.0f * (combinedArea - area);
+
+        float costLeft = nodes[left].aabb.merge(leafAABB).getSurfaceArea() + inheritanceCost;
+        if (!nodes[left].isLeaf()) {
+            costLeft -= nodes[left].aabb.getSurfaceArea();
+        }
+
+        float costRight = nodes[right].aabb.merge(leafAABB).getSurfaceArea() + inheritanceCost;
+        if (!nodes[right].isLeaf()) {
+            costRight -= nodes[right].aabb.getSurfaceArea();
+        }
+
+        if (cost < costLeft && cost < costRight) {
+            break;
+        }
+
+        index = (costLeft < costRight) ? left : right;
+    }
+
+    int sibling = index;
+    int oldParent = nodes[sibling].parent;
+
+    // allocateNode()가 배열을 재할당할 수 있으므로 인덱스로만 접근
+    int newParent = allocateNode();
+    nodes[newParent].parent = oldParent;
+    nodes[newParent].aabb = leafAABB.merge(nodes[sibling].aabb);
+    nodes[newParent].height = nodes[sibling].height + 1;
+
+    if (oldParent != NULL_NODE) {
+        if (nodes[oldParent].left == sibling) {
+            nodes[oldParent].left = newParent;
+        } else {
+            nodes[oldParent].right = newParent;
+        }
+    } else {
+        root = newParent;
+    }
+
+    nodes[newParent].left = sibling;
+    nodes[newParent].right = leaf;
+    nodes[sibling].parent = newParent;
+    nodes[leaf].parent = newParent;
+
+    refitAncestors(newParent);
+}
+
+// 리프를 떼어내고 부모 자리를 형제 노드로 대체
+void BVH::removeLeaf(int leaf) {
+    if (leaf == root) {
+        root = NULL_NODE;
+        return;
+    }
+
+    int parent = nodes[leaf].parent;
+    int grandParent = nodes[parent].parent;
+    int sibling = (nodes[parent].left == leaf) ? nodes[parent].right : nodes[parent].left;
+
+    if (grandParent != NULL_NODE) {
+        if (nodes[grandParent].left == parent) {
+            nodes[grandParent].left = sibling;
+        } else {
+            nodes[grandParent].right = sibling;
+        }
+        nodes[sibling].parent = grandParent;
+        freeNode(parent);
+
+        refitAncestors(grandParent);
+    } else {
+        root = sibling;
+        nodes[sibling].parent = NULL_NODE;
+        freeNode(parent);
+    }
+
+    nodes[leaf].parent = NULL_NODE;
+}
+
+// 삽입/제거 경로를 따라 올라가며 AABB와 높이를 다시 계산
+void BVH::refitAncestors(int node) {
+    while (node != NULL_NODE) {
+        node = balance(node);
+
+        int left = nodes[node].left;
+        int right = nodes[node].right;
+
+        nodes[node].height = 1 + std::max(nodes[left].height, nodes[right].height);
+        nodes[node].aabb = nodes[left].aabb.merge(nodes[right].aabb);
+
+        node = nodes[node].parent;
+    }
+}
+
+// 자식 높이 차이가 1보다 크면 더 높은 자식을 위로 올리는 회전 수행
+// 회전 후 서브트리의 새 루트를 반환
+int BVH::balance(int iA) {
+    BVHNode& A = nodes[iA];
+    if (A.isLeaf() || A.height < 2) {
+        return iA;
+    }
+
+    int iB = A.left;
+    int iC = A.right;
+    BVHNode& B = nodes[iB];
+    BVHNode& C = nodes[iC];
+
+    int heightDiff = C.height - B.height;
+
+    // 오른쪽 자식 C를 위로 올림
+    if (heightDiff > 1) {
+        int iF = C.left;
+        int iG = C.right;
+        BVHNode& F = nodes[iF];
+        BVHNode& G = nodes[iG];
+
+        C.left = iA;
+        C.parent = A.parent;
+        A.parent = iC;
+
+        if (C.parent != NULL_NODE) {
+            if (nodes[C.parent].left == iA) {
+                nodes[C.parent].left = iC;
+            } else {
+                nodes[C.parent].right = iC;
+            }
+        } else {
+            root = iC;
+        }
+
+        if (F.height > G.height) {
+            C.right = iF;
+            A.right = iG;
+            G.parent = iA;
+            A.aabb = B.aabb.merge(G.aabb);
+            C.aabb = A.aabb.merge(F.aabb);
+            A.height = 1 + std::max(B.height, G.height);
+            C.height = 1 + std::max(A.height, F.height);
+        } else {
+            C.right = iG;
+            A.right = iF;
+            F.parent = iA;
+            A.aabb = B.aabb.merge(F.aabb);
+            C.aabb = A.aabb.merge(G.aabb);
+            A.height = 1 + std::max(B.height, F.height);
+            C.height = 1 + std::max(A.height, G.height);
+        }
+
+        return iC;
+    }
+
+    // 왼쪽 자식 B를 위로 올림
+    if (heightDiff < -1) {
+        int iD = B.left;
+        int iE = B.right;
+        BVHNode& D = nodes[iD];
+        BVHNode& E = nodes[iE];
+
+        B.left = iA;
+        B.parent = A.parent;
+        A.parent = iB;
+
+        if (B.parent != NULL_NODE) {
+            if (nodes[B.parent].left == iA) {
+                nodes[B.parent].left = iB;
+            } else {
+                nodes[B.parent].right = iB;
+            }
+        } else {
+            root = iB;
+        }
+
+        if (D.height > E.height) {
+            B.right = iD;
+            A.left = iE;
+            E.parent = iA;
+            A.aabb = C.aabb.merge(E.aabb);
+            B.aabb = A.aabb.merge(D.aabb);
+            A.height = 1 + std::max(C.height, E.height);
+            B.height = 1 + std::max(A.height, D.height);
+        } else {
+            B.right = iE;
+            A.left = iD;
+            D.parent = iA;
+            A.aabb = C.aabb.merge(D.aabb);
+            B.aabb = A.aabb.merge(E.aabb);
+            A.height = 1 + std::max(C.height, D.height);
+            B.height = 1 + std::max(A.height, E.height);
+        }
+
+        return iB;
+    }
+
+    return iA;
+}
+
+// 트리 대 트리 자기 순회: (노드, 노드) 쌍을 스택으로 처리
+// 같은 노드 쌍은 자식끼리 세 가지 조합으로 나누고, 다른 노드 쌍은 큰 쪽을 분할
+void BVH::findCollisionPairs(std::vector<std::pair<Object3D*, Object3D*>>& collisionPairs) {
+    if (root == NULL_NODE || nodes[root].isLeaf()) {
+        return;
+    }
+
+    pairStack.clear();
+    pairStack.emplace_back(root, root);
+
+    while (!pairStack.empty()) {
+        int a = pairStack.back().first;
+        int b = pairStack.back().second;
+        pairStack.pop_back();
+
+        const BVHNode& nodeA = nodes[a];
+        const BVHNode& nodeB = nodes[b];
+
+        if (a == b) {
+            if (nodeA.isLeaf()) {
+                continue;
+            }
+            pairStack.emplace_back(nodeA.left, nodeA.left);
+            pairStack.emplace_back(nodeA.right, nodeA.right);
+            pairStack.emplace_back(nodeA.left, nodeA.right);
+            continue;
+        }
+
+        // 두 노드의 AABB가 교차하지 않으면 건너뜀
+        if (!nodeA.aabb.intersects(nodeB.aabb)) {
+            continue;
+        }
+
+        if (nodeA.isLeaf() && nodeB.isLeaf()) {
+            // fat AABB끼리의 겹침이므로 실제 월드 AABB로 한 번 더 확인
+            if (nodeA.object->getAABB().intersects(nodeB.object->getAABB())) {
+                collisionPairs.emplace_back(nodeA.object, nodeB.object);
+            }
+            continue;
+        }
+
+        if (nodeB.isLeaf() || (!nodeA.isLeaf() && nodeA.height >= nodeB.height)) {
+            int left = nodeA.left;
+            int right = nodeA.right;
+            pairStack.emplace_back(left, b);
+            pairStack.emplace_back(right, b);
+        } else {
+            int left = nodeB.left;
+            int right = nodeB.right;
+            pairStack.emplace_back(a, left);
+            pairStack.emplace_back(a, right);
+        }
+    }
+}
+
+// 주어진 AABB와 fat AABB가 겹치는 리프의 객체 수집
+void BVH::query(const AABB& aabb, std::vector<Object3D*>& results) const {
+    if (root == NULL_NODE) {
+        return;
+    }
+
+    std::vector<int> stack;
+    stack.push_back(root);
+
+    while (!stack.empty()) {
+        int index = stack.back();
+        stack.pop_back();
+
+        const BVHNode& node = nodes[index];
+        if (!node.aabb.intersects(aabb)) {
+            continue;
+        }
+
+        if (node.isLeaf()) {
+            results.push_back(node.object);
+        } else {
+            stack.push_back(node.left);
+            stack.push_back(node.right);
+        }
+    }
+}
+
+} // namespace Collision
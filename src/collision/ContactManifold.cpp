@@ -0,0 +1,406 @@
+#include "ContactManifold.h"
+#include <cmath>
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+namespace Collision {
+
+    namespace {
+
+        // EPA 법선이 면 법선과 이 코사인 이상 가까울 때만 면 접촉으로 보고 자름 (아니면 변/꼭짓점 접촉)
+        const float FACE_ALIGNMENT_COS = 0.99f;
+
+        // 두 껍질 면이 법선에 비슷하게 맞으면 A 면을 기준 면으로 우선
+        const float REFERENCE_TOLERANCE = 0.98f;
+
+    } // namespace
+
+    Vector3 ContactManifold::center() const {
+        Vector3 sum(0, 0, 0);
+        for (int i = 0; i < pointCount; ++i) {
+            sum += points[i].position;
+        }
+        return pointCount > 0 ? sum / static_cast<float>(pointCount) : sum;
+    }
+
+    float ContactManifold::maxDepth() const {
+        float depth = 0.0f;
+        for (int i = 0; i < pointCount; ++i) {
+            if (points[i].depth > depth) {
+                depth = points[i].depth;
+            }
+        }
+        return depth;
+    }
+
+    void ContactManifold::merge(const ContactManifold& fresh, float matchDistance) {
+        bool sameHulls = pointCount > 0 && fresh.hullA == hullA && fresh.hullB == hullB;
+        bool sameFeatures = sameHulls && fresh.feature == feature && feature != SATFeature::NONE;
+        float matchDistanceSq = matchDistance * matchDistance;
+
+        ContactManifold result = fresh;
+        for (int i = 0; i < result.pointCount; ++i) {
+            ContactPoint& point = result.points[i];
+            point.lifetime = 0;
+
+            int match = -1;
+            if (sameFeatures) {
+                for (int j = 0; j < pointCount; ++j) {
+                    if (points[j].featureId == point.featureId) {
+                        match = j;
+                        break;
+                    }
+                }
+            }
+            if (match < 0 && sameHulls) {
+                // 특징이 바뀌었으면 A 로컬 위치가 가장 가까운 지난 점
+                float bestSq = matchDistanceSq;
+                for (int j = 0; j < pointCount; ++j) {
+                    float distanceSq = (points[j].localA - point.localA).magnitudeSquared();
+                    if (distanceSq < bestSq) {
+                        bestSq = distanceSq;
+                        match = j;
+                    }
+                }
+            }
+            if (match >= 0) {
+                point.lifetime = points[match].lifetime + 1;
+            }
+        }
+        *this = result;
+    }
+
+    ContactPoint ManifoldBuilder::makePoint(const Transform& inverseA, const Transform& inverseB,
+                                            const Vector3& pointA, const Vector3& pointB, float depth, uint64_t featureId) {
+        ContactPoint point;
+        point.position = (pointA + pointB) * 0.5f;
+        point.localA = inverseA.transformPoint(pointA);
+        point.localB = inverseB.transformPoint(pointB);
+        point.depth = depth;
+        point.featureId = featureId;
+        point.lifetime = 0;
+        return point;
+    }
+
+    void ManifoldBuilder::reducePoints(ContactManifold& manifold, const ContactPoint* candidates, int count) {
+        if (count <= ContactManifold::MAX_POINTS) {
+            for (int i = 0; i < count; ++i) {
+                manifold.points[i] = candidates[i];
+            }
+            manifold.pointCount = count;
+            return;
+        }
+
+        const Vector3& normal = manifold.normal;
+
+        // 1. 가장 깊은 점
+        int first = 0;
+        for (int i = 1; i < count; ++i) {
+            if (candidates[i].depth > candidates[first].depth) {
+                first = i;
+            }
+        }
+        const Vector3& p0 = candidates[first].position;
+
+        // 2. 첫 점에서 가장 먼 점
+        int second = first == 0 ? 1 : 0;
+        float bestDistance = -1.0f;
+        for (int i = 0; i < count; ++i) {
+            float distanceSq = (candidates[i].position - p0).magnitudeSquared();
+            if (i != first && distanceSq > bestDistance) {
+                bestDistance = distanceSq;
+                second = i;
+            }
+        }
+        const Vector3& p1 = candidates[second].position;
+
+        // 3. 두 점과 만드는 삼각형 넓이가 가장 큰 점
+        int third = -1;
+        float bestArea = -1.0f;
+        for (int i = 0; i < count; ++i) {
+            if (i == first || i == second) {
+                continue;
+            }
+            float area = std::abs((p1 - p0).cross(candidates[i].position - p0).dot(normal));
+            if (area > bestArea) {
+                bestArea = area;
+                third = i;
+            }
+        }
+        const Vector3& p2 = candidates[third].position;
+
+        // 4. 삼각형 바깥으로 가장 멀리 벗어나 사각형 넓이를 가장 키우는 점
+        float orientation = (p1 - p0).cross(p2 - p0).dot(normal) < 0.0f ? -1.0f : 1.0f;
+        const Vector3* corners[3] = { &p0, &p1, &p2 };
+        int fourth = -1;
+        float bestOutside = -std::numeric_limits<float>::max();
+        for (int i = 0; i < count; ++i) {
+            if (i == first || i == second || i == third) {
+                continue;
+            }
+            float outside = -std::numeric_limits<float>::max();
+            for (int e = 0; e < 3; ++e) {
+                const Vector3& a = *corners[e];
+                const Vector3& b = *corners[(e + 1) % 3];
+                float signedArea = orientation * (b - a).cross(candidates[i].position - a).dot(normal);
+                if (-signedArea > outside) {
+                    outside = -signedArea;
+                }
+            }
+            if (outside > bestOutside) {
+                bestOutside = outside;
+                fourth = i;
+            }
+        }
+
+        manifold.points[0] = candidates[first];
+        manifold.points[1] = candidates[second];
+        manifold.points[2] = candidates[third];
+        manifold.pointCount = 3;
+        if (fourth >= 0 && bestOutside > 0.0f) {
+            manifold.points[manifold.pointCount++] = candidates[fourth];
+        }
+    }
+
+    bool ManifoldBuilder::clipFaces(const ConvexHull& shapeA, const Transform& transformA,
+                                    const ConvexHull& shapeB, const Transform& transformB,
+                                    bool referenceIsA, int referenceFace, ContactManifold& manifold) {
+        const ConvexHull& reference = referenceIsA ? shapeA : shapeB;
+        const ConvexHull& incident = referenceIsA ? shapeB : shapeA;
+        const Transform& referenceTransform = referenceIsA ? transformA : transformB;
+        const Transform& incidentTransform = referenceIsA ? transformB : transformA;
+        if (!reference.hasFeatures() || !incident.hasFeatures() ||
+            referenceFace < 0 || referenceFace >= static_cast<int>(reference.faces.size())) {
+            return false;
+        }
+
+        // 기준 면 (월드)
+        const HullFace& face = reference.faces[referenceFace];
+        Vector3 referenceNormal = (referenceTransform.normalMatrix() * face.normal).normalized();
+        referencePolygon.clear();
+        for (int k = 0; k < face.vertexCount; ++k) {
+            int index = reference.faceVertices[face.firstVertex + k];
+            referencePolygon.push_back(referenceTransform.transformPoint(reference.vertices[index]));
+        }
+
+        // 입사 면: 기준 법선과 가장 반대 방향인 면
+        Matrix3x3 incidentNormalMatrix = incidentTransform.normalMatrix();
+        int incidentFace = 0;
+        float minDot = std::numeric_limits<float>::max();
+        for (size_t f = 0; f < incident.faces.size(); ++f) {
+            float d = (incidentNormalMatrix * incident.faces[f].normal).normalized().dot(referenceNormal);
+            if (d < minDot) {
+                minDot = d;
+                incidentFace = static_cast<int>(f);
+            }
+        }
+        const HullFace& incidentPolygon = incident.faces[incidentFace];
+        polygon.clear();
+        for (int k = 0; k < incidentPolygon.vertexCount; ++k) {
+            int index = incident.faceVertices[incidentPolygon.firstVertex + k];
+            ClipVertex vertex;
+            vertex.position = incidentTransform.transformPoint(incident.vertices[index]);
+            vertex.clipPlane = 0;
+            vertex.incidentVertex = k;
+            polygon.push_back(vertex);
+        }
+
+        // 기준 면의 각 변을 지나고 면에 수직인 측면 평면으로 자르기 (바깥쪽 제거)
+        int referenceCount = static_cast<int>(referencePolygon.size());
+        for (int e = 0; e < referenceCount && !polygon.empty(); ++e) {
+            const Vector3& r0 = referencePolygon[e];
+            const Vector3& r1 = referencePolygon[(e + 1) % referenceCount];
+            Vector3 planeNormal = (r1 - r0).cross(referenceNormal);
+            float planeOffset = planeNormal.dot(r0);
+
+            clipped.clear();
+            size_t count = polygon.size();
+            for (size_t i = 0; i < count; ++i) {
+                const ClipVertex& current = polygon[i];
+                const ClipVertex& next = polygon[(i + 1) % count];
+                float dc = planeNormal.dot(current.position) - planeOffset;
+                float dn = planeNormal.dot(next.position) - planeOffset;
+                if (dc <= 0.0f) {
+                    clipped.push_back(current);
+                }
+                if ((dc <= 0.0f) != (dn <= 0.0f)) {
+                    ClipVertex vertex;
+                    vertex.position = current.position + (next.position - current.position) * (dc / (dc - dn));
+                    vertex.clipPlane = e + 1;
+                    vertex.incidentVertex = current.incidentVertex;
+                    clipped.push_back(vertex);
+                }
+            }
+            std::swap(polygon, clipped);
+        }
+
+        // 기준 면 아래(침투)에 있는 점만 접촉점 후보
+        Transform inverseA = transformA.inverse();
+        Transform inverseB = transformB.inverse();
+        float referenceOffset = referenceNormal.dot(referencePolygon[0]);
+        manifold.normal = referenceIsA ? referenceNormal : -referenceNormal;
+        manifold.feature = referenceIsA ? SATFeature::FACE_A : SATFeature::FACE_B;
+
+        candidates.clear();
+        for (const ClipVertex& vertex : polygon) {
+            float depth = referenceOffset - referenceNormal.dot(vertex.position);
+            if (depth < 0.0f) {
+                continue;
+            }
+            Vector3 onReference = vertex.position + referenceNormal * depth;
+            candidates.push_back(makePoint(inverseA, inverseB,
+                                           referenceIsA ? onReference : vertex.position,
+                                           referenceIsA ? vertex.position : onReference,
+                                           depth, ContactManifold::makeFeatureId(referenceFace, incidentFace,
+                                                                                 vertex.clipPlane, vertex.incidentVertex)));
+        }
+        if (candidates.empty()) {
+            return false;
+        }
+
+        reducePoints(manifold, candidates.data(), static_cast<int>(candidates.size()));
+        return true;
+    }
+
+    // 변 쌍의 최근접점으로 한 점
+    void ManifoldBuilder::edgeContact(const ConvexHull& shapeA, const Transform& transformA,
+                                      const ConvexHull& shapeB, const Transform& transformB,
+                                      const SATResult& sat, ContactManifold& manifold) const {
+        const HullEdge& edgeA = shapeA.edges[sat.indexA];
+        const HullEdge& edgeB = shapeB.edges[sat.indexB];
+        Vector3 closestA, closestB;
+        ClosestSegmentPoints(transformA.transformPoint(shapeA.vertices[edgeA.v0]),
+                             transformA.transformPoint(shapeA.vertices[edgeA.v1]),
+                             transformB.transformPoint(shapeB.vertices[edgeB.v0]),
+                             transformB.transformPoint(shapeB.vertices[edgeB.v1]),
+                             closestA, closestB);
+
+        manifold.normal = sat.normal;
+        manifold.feature = SATFeature::EDGES;
+        manifold.points[0] = makePoint(transformA.inverse(), transformB.inverse(), closestA, closestB,
+                                       -sat.separation, ContactManifold::makeEdgeFeatureId(sat.indexA, sat.indexB));
+        manifold.pointCount = 1;
+    }
+
+    // 두 선분의 최근접점 (Ericson, Real-Time Collision Detection 5.1.9)
+    void ManifoldBuilder::ClosestSegmentPoints(const Vector3& p1, const Vector3& q1, const Vector3& p2, const Vector3& q2,
+                                               Vector3& c1, Vector3& c2) {
+        Vector3 d1 = q1 - p1;
+        Vector3 d2 = q2 - p2;
+        Vector3 r = p1 - p2;
+        float a = d1.dot(d1);
+        float e = d2.dot(d2);
+        float f = d2.dot(r);
+        float s = 0.0f, t = 0.0f;
+
+        if (a <= 1e-12f && e <= 1e-12f) {
+            c1 = p1;
+            c2 = p2;
+            return;
+        }
+        if (a <= 1e-12f) {
+            t = std::min(std::max(f / e, 0.0f), 1.0f);
+        } else {
+            float c = d1.dot(r);
+            if (e <= 1e-12f) {
+                s = std::min(std::max(-c / a, 0.0f), 1.0f);
+            } else {
+                float b = d1.dot(d2);
+                float denominator = a * e - b * b;
+                if (denominator > 1e-12f) {
+                    s = std::min(std::max((b * f - c * e) / denominator, 0.0f), 1.0f);
+                }
+                t = (b * s + f) / e;
+                if (t < 0.0f) {
+                    t = 0.0f;
+                    s = std::min(std::max(-c / a, 0.0f), 1.0f);
+                } else if (t > 1.0f) {
+                    t = 1.0f;
+                    s = std::min(std::max((b - c) / a, 0.0f), 1.0f);
+                }
+            }
+        }
+        c1 = p1 + d1 * s;
+        c2 = p2 + d2 * t;
+    }
+
+    bool ManifoldBuilder::FromSAT(const ConvexHull& shapeA, const Transform& transformA,
+                                  const ConvexHull& shapeB, const Transform& transformB,
+                                  const SATResult& sat, ContactManifold& manifold) {
+        manifold.clear();
+        switch (sat.feature) {
+            case SATFeature::FACE_A:
+                return clipFaces(shapeA, transformA, shapeB, transformB, true, sat.indexA, manifold);
+            case SATFeature::FACE_B:
+                return clipFaces(shapeA, transformA, shapeB, transformB, false, sat.indexB, manifold);
+            case SATFeature::EDGES:
+                if (sat.indexA < 0 || sat.indexA >= static_cast<int>(shapeA.edges.size()) ||
+                    sat.indexB < 0 || sat.indexB >= static_cast<int>(shapeB.edges.size())) {
+                    return false;
+                }
+                edgeContact(shapeA, transformA, shapeB, transformB, sat, manifold);
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    bool ManifoldBuilder::FromEPA(const ConvexHull& shapeA, const Transform& transformA,
+                                  const ConvexHull& shapeB, const Transform& transformB,
+                                  const EPAResult& epa, ContactManifold& manifold) {
+        manifold.clear();
+
+        // 법선에 가장 잘 맞는 A 면과 (-법선에) 가장 잘 맞는 B 면 중 하나를 기준 면으로
+        if (shapeA.hasFeatures() && shapeB.hasFeatures()) {
+            auto bestFace = [](const ConvexHull& shape, const Transform& transform, const Vector3& direction,
+                               float& bestDot) {
+                Matrix3x3 normalMatrix = transform.normalMatrix();
+                int best = -1;
+                bestDot = -std::numeric_limits<float>::max();
+                for (size_t f = 0; f < shape.faces.size(); ++f) {
+                    float d = (normalMatrix * shape.faces[f].normal).normalized().dot(direction);
+                    if (d > bestDot) {
+                        bestDot = d;
+                        best = static_cast<int>(f);
+                    }
+                }
+                return best;
+            };
+            float dotA, dotB;
+            int faceA = bestFace(shapeA, transformA, epa.normal, dotA);
+            int faceB = bestFace(shapeB, transformB, -epa.normal, dotB);
+            bool referenceIsA = dotA >= dotB * REFERENCE_TOLERANCE;
+            float alignment = referenceIsA ? dotA : dotB;
+            if (alignment > FACE_ALIGNMENT_COS &&
+                clipFaces(shapeA, transformA, shapeB, transformB, referenceIsA, referenceIsA ? faceA : faceB, manifold)) {
+                return true;
+            }
+        }
+
+        // 면 접촉이 아니거나 면 정보가 없으면 EPA 접촉점 한 점
+        SinglePoint(transformA, transformB, epa.normal, epa.pointA, epa.pointB, epa.depth, manifold);
+        return true;
+    }
+
+    void ManifoldBuilder::SinglePoint(const Transform& transformA, const Transform& transformB, const Vector3& normal,
+                                      const Vector3& pointA, const Vector3& pointB, float depth,
+                                      ContactManifold& manifold) {
+        manifold.normal = normal;
+        manifold.feature = SATFeature::NONE;
+        manifold.pointCount = 0;
+        AddPoint(transformA, transformB, pointA, pointB, depth, 0, manifold);
+    }
+
+    bool ManifoldBuilder::AddPoint(const Transform& transformA, const Transform& transformB,
+                                   const Vector3& pointA, const Vector3& pointB, float depth, uint64_t featureId,
+                                   ContactManifold& manifold) {
+        if (manifold.pointCount >= ContactManifold::MAX_POINTS) {
+            return false;
+        }
+        manifold.points[manifold.pointCount++] =
+            makePoint(transformA.inverse(), transformB.inverse(), pointA, pointB, depth, featureId);
+        return true;
+    }
+
+} // namespace Collision
@@ -0,0 +1,266 @@
+#include "EPA.h"
+#include <cmath>
+#include <limits>
+
+namespace Collision {
+
+    namespace {
+
+        // 지원점이 기존 다면체에서 이 거리 이상 벗어나지 못하면 수렴
+        const float TOLERANCE = 1e-4f;
+
+        // 사면체를 만들 때 새 점이 기존 점/선/면에서 떨어져 있다고 볼 최소 거리 제곱
+        const float DEGENERATE_EPSILON = 1e-10f;
+
+        // 새 점이 면 평면 위(오차 범위)에 있어도 보이는 면으로 취급
+        // Minkowski 차의 넓은 평면을 나눈 삼각형들 사이에서 일부만 지워지면 새 면이 기존 면과 겹치며 뒤집힌다.
+        const float VISIBLE_EPSILON = 1e-5f;
+
+    } // namespace
+
+    EPA::EPA()
+        : vertices(MAX_VERTICES), faces(MAX_FACES), horizon(MAX_EDGES),
+          vertexCount(0), faceCount(0), edgeCount(0), supportA(-1), supportB(-1) {}
+
+    SimplexVertex EPA::support(
+        const ConvexHull& shapeA, const Transform& transformA,
+        const ConvexHull& shapeB, const Transform& transformB,
+        const Vector3& direction
+    ) {
+        SimplexVertex vertex;
+        vertex.a = shapeA.support(direction, transformA, supportA);
+        vertex.b = shapeB.support(-direction, transformB, supportB);
+        vertex.w = vertex.a - vertex.b;
+        vertex.indexA = supportA;
+        vertex.indexB = supportB;
+        return vertex;
+    }
+
+    bool EPA::buildTetrahedron(
+        const ConvexHull& shapeA, const Transform& transformA,
+        const ConvexHull& shapeB, const Transform& transformB
+    ) {
+        static const Vector3 axes[6] = {
+            Vector3(1, 0, 0), Vector3(-1, 0, 0), Vector3(0, 1, 0),
+            Vector3(0, -1, 0), Vector3(0, 0, 1), Vector3(0, 0, -1)
+        };
+
+        // 점 하나: 그 점(원점)에서 떨어진 지원점을 축 방향으로 찾음
+        if (vertexCount == 1) {
+            for (const Vector3& axis : axes) {
+                SimplexVertex vertex = support(shapeA, transformA, shapeB, transformB, axis);
+                if ((vertex.w - vertices[0].w).magnitudeSquared() > DEGENERATE_EPSILON) {
+                    vertices[vertexCount++] = vertex;
+                    break;
+                }
+            }
+            if (vertexCount < 2) {
+                return false;
+            }
+        }
+
+        // 선분: 선분에 수직인 네 방향 중 직선에서 벗어난 지원점
+        if (vertexCount == 2) {
+            Vector3 line = vertices[1].w - vertices[0].w;
+            float ax = std::abs(line.x), ay = std::abs(line.y), az = std::abs(line.z);
+            const Vector3& axis = (ax <= ay && ax <= az) ? axes[0] : (ay <= az ? axes[2] : axes[4]);
+            Vector3 e1 = line.cross(axis);
+            Vector3 e2 = line.cross(e1);
+            const Vector3 directions[4] = { e1, -e1, e2, -e2 };
+
+            float lineSq = line.magnitudeSquared();
+            for (const Vector3& direction : directions) {
+                SimplexVertex vertex = support(shapeA, transformA, shapeB, transformB, direction);
+                Vector3 offset = (vertex.w - vertices[0].w).cross(line);
+                if (offset.magnitudeSquared() > DEGENERATE_EPSILON * lineSq) {
+                    vertices[vertexCount++] = vertex;
+                    break;
+                }
+            }
+            if (vertexCount < 3) {
+                return false;
+            }
+        }
+
+        // 삼각형: 법선 양쪽 중 평면에서 벗어난 지원점
+        if (vertexCount == 3) {
+            Vector3 normal = (vertices[1].w - vertices[0].w).cross(vertices[2].w - vertices[0].w);
+            float normalSq = normal.magnitudeSquared();
+            if (normalSq < DEGENERATE_EPSILON) {
+                return false;
+            }
+            const Vector3 directions[2] = { normal, -normal };
+            for (const Vector3& direction : directions) {
+                SimplexVertex vertex = support(shapeA, transformA, shapeB, transformB, direction);
+                float height = normal.dot(vertex.w - vertices[0].w);
+                if (height * height > DEGENERATE_EPSILON * normalSq) {
+                    vertices[vertexCount++] = vertex;
+                    break;
+                }
+            }
+            if (vertexCount < 4) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool EPA::addFace(int a, int b, int c) {
+        if (faceCount >= MAX_FACES) {
+            return false;
+        }
+
+        const Vector3& pa = vertices[a].w;
+        Vector3 normal = (vertices[b].w - pa).cross(vertices[c].w - pa);
+        float length = normal.magnitude();
+        if (length < 1e-12f) {
+            return false;
+        }
+
+        Face& face = faces[faceCount++];
+        face.v[0] = a;
+        face.v[1] = b;
+        face.v[2] = c;
+        face.normal = normal / length;
+        face.distance = face.normal.dot(pa);
+        return true;
+    }
+
+    // 보이는 면들의 변 중 두 면이 공유하는 변(반대 방향으로 두 번 나옴)은 지우고 한 번만 나온 변만 남김
+    void EPA::addHorizonEdge(int a, int b) {
+        for (int i = 0; i < edgeCount; ++i) {
+            if (horizon[i].a == b && horizon[i].b == a) {
+                horizon[i] = horizon[--edgeCount];
+                return;
+            }
+        }
+        if (edgeCount < MAX_EDGES) {
+            horizon[edgeCount].a = a;
+            horizon[edgeCount].b = b;
+            edgeCount++;
+        }
+    }
+
+    int EPA::closestFace() const {
+        int best = 0;
+        float bestDistance = std::numeric_limits<float>::max();
+        for (int i = 0; i < faceCount; ++i) {
+            if (faces[i].distance < bestDistance) {
+                bestDistance = faces[i].distance;
+                best = i;
+            }
+        }
+        return best;
+    }
+
+    void EPA::computeContactPoints(const Face& face, EPAResult& result) const {
+        const SimplexVertex& v0 = vertices[face.v[0]];
+        const SimplexVertex& v1 = vertices[face.v[1]];
+        const SimplexVertex& v2 = vertices[face.v[2]];
+
+        // 원점을 면 평면에 투영한 점의 무게 중심 좌표
+        Vector3 p = face.normal * face.distance;
+        Vector3 e0 = v1.w - v0.w;
+        Vector3 e1 = v2.w - v0.w;
+        Vector3 ep = p - v0.w;
+        float d00 = e0.dot(e0);
+        float d01 = e0.dot(e1);
+        float d11 = e1.dot(e1);
+        float d20 = ep.dot(e0);
+        float d21 = ep.dot(e1);
+        float denominator = d00 * d11 - d01 * d01;
+
+        float u = 1.0f, v = 0.0f, w = 0.0f;
+        if (std::abs(denominator) > 1e-12f) {
+            v = (d11 * d20 - d01 * d21) / denominator;
+            w = (d00 * d21 - d01 * d20) / denominator;
+            u = 1.0f - v - w;
+        }
+
+        result.pointA = v0.a * u + v1.a * v + v2.a * w;
+        result.pointB = v0.b * u + v1.b * v + v2.b * w;
+    }
+
+    bool EPA::Penetration(
+        const ConvexHull& shapeA,
+        const Transform& transformA,
+        const ConvexHull& shapeB,
+        const Transform& transformB,
+        const Simplex& simplex,
+        EPAResult& result
+    ) {
+        result = EPAResult();
+        if (shapeA.vertices.empty() || shapeB.vertices.empty() || simplex.isEmpty()) {
+            return false;
+        }
+
+        // 풀 재사용: 개수만 되돌림
+        vertexCount = 0;
+        faceCount = 0;
+        edgeCount = 0;
+        for (int i = 0; i < Simplex::MAX_VERTICES; ++i) {
+            if (simplex.getBits() & (1u << i)) {
+                vertices[vertexCount++] = simplex.getVertex(i);
+            }
+        }
+        supportA = vertices[0].indexA;
+        supportB = vertices[0].indexB;
+
+        if (vertexCount < 4 && !buildTetrahedron(shapeA, transformA, shapeB, transformB)) {
+            return false;
+        }
+
+        // 면 (0,1,2)의 법선이 3번 꼭짓점 반대쪽을 향하도록 정렬한 뒤 바깥 방향 면 4개 생성
+        Vector3 w0 = vertices[0].w;
+        if ((vertices[1].w - w0).cross(vertices[2].w - w0).dot(vertices[3].w - w0) > 0.0f) {
+            SimplexVertex temp = vertices[1];
+            vertices[1] = vertices[2];
+            vertices[2] = temp;
+        }
+        if (!addFace(0, 1, 2) || !addFace(0, 3, 1) || !addFace(0, 2, 3) || !addFace(1, 3, 2)) {
+            return false;
+        }
+
+        Face best = faces[closestFace()];
+        for (result.iterations = 0; result.iterations < MAX_ITERATIONS; ++result.iterations) {
+            best = faces[closestFace()];
+
+            // 가장 가까운 면의 법선 방향으로 더 나아가지 못하면 그 면이 Minkowski 차의 경계
+            SimplexVertex vertex = support(shapeA, transformA, shapeB, transformB, best.normal);
+            if (vertex.w.dot(best.normal) - best.distance < TOLERANCE || vertexCount >= MAX_VERTICES) {
+                break;
+            }
+
+            int index = vertexCount;
+            vertices[vertexCount++] = vertex;
+
+            // 새 점에서 보이는 면을 지우고 그 경계(지평선) 변을 새 점과 이어 다면체 확장
+            edgeCount = 0;
+            for (int i = faceCount - 1; i >= 0; --i) {
+                const Face& face = faces[i];
+                if (face.normal.dot(vertex.w - vertices[face.v[0]].w) > -VISIBLE_EPSILON) {
+                    addHorizonEdge(face.v[0], face.v[1]);
+                    addHorizonEdge(face.v[1], face.v[2]);
+                    addHorizonEdge(face.v[2], face.v[0]);
+                    faces[i] = faces[--faceCount];
+                }
+            }
+
+            bool expanded = true;
+            for (int i = 0; i < edgeCount && expanded; ++i) {
+                expanded = addFace(horizon[i].a, horizon[i].b, index);
+            }
+            if (!expanded || faceCount == 0) {
+                // 용량이 차거나 퇴화한 면이 생기면 마지막으로 확인한 면을 결과로 사용
+                break;
+            }
+        }
+
+        result.normal = best.normal;
+        result.depth = best.distance > 0.0f ? best.distance : 0.0f;
+        computeContactPoints(best, result);
+        return true;
+    }
+
+} // namespace Collision
@@ -1,10 +1,7 @@
 #include "GJK.h"
 #include <cmath>
 #include <algorithm>
-#include <iostream>
-#include <set>
-#include <tuple>
-#include <functional>
+#include <limits>
 #include "Quaternion.h"
 
 namespace Collision {
@@ -25,30 +22,17 @@ namespace Collision {
         return worldPointA - worldPointB;
     }
 
-    // ConvexHull에서 특정 방향으로 가장 멀리 있는 점 찾기
-    Vector3 GJK::getFarthestPointInDirection(const ConvexHull& shape, 
-        const Vector3& dir, 
-        const Vector3& position
-    ) {
-        if (shape.vertices.empty()) {
-            return position;
+    // 변환된 볼록체의 Support 함수 (방향을 로컬로 바꿔 탐색하고 선택된 정점만 월드로 변환)
+    Vector3 GJK::Support(const ConvexHull& shapeA, const Transform& transformA,
+                        const ConvexHull& shapeB, const Transform& transformB,
+                        const Vector3& dir) {
+        return shapeA.support(dir, transformA) - shapeB.support(-dir, transformB);
     }
 
-        Vector3 furthestPoint;
-        float maxDot = -std::numeric_limits<float>::max();
-
-        for (const auto& vertex : shape.vertices) {
-            // 정점을 월드 좌표로 변환
-            Vector3 worldVertex = vertex + position;
-            float dot = worldVertex.dot(dir);
-
-            if (dot > maxDot) {
-                maxDot = dot;
-                furthestPoint = worldVertex;
-        }
-    }
-
-        return furthestPoint;
+    Vector3 GJK::Support(const ConvexHull& shapeA, const Transform& transformA,
+                        const ConvexHull& shapeB, const Transform& transformB,
+                        const Vector3& dir, GJKCache& cache) {
+        return shapeA.support(dir, transformA, cache.supportA) - shapeB.support(-dir, transformB, cache.supportB);
     }
 
     bool GJK::Intersect(
@@ -57,216 +41,374 @@ namespace Collision {
         const Vector3& posA, 
         const Vector3& posB
     ) {
-        // 초기 방향: B에서 A 방향 (보통 더 잘 수렴)
-        Vector3 direction = (posA - posB).normalized();
-        if (direction.magnitudeSquared() < 1e-6f) {
-        direction = Vector3(1, 0, 0); // 방향이 너무 작으면 기본값 사용
+        return Intersect(shapeA, Transform::translation(posA), shapeB, Transform::translation(posB));
+    }
+
+    bool GJK::Intersect(
+        const ConvexHull& shapeA,
+        const Transform& transformA,
+        const ConvexHull& shapeB,
+        const Transform& transformB,
+        GJKCache* cache
+    ) {
+        // 빈 ConvexHull 체크
+        if (shapeA.vertices.empty() || shapeB.vertices.empty()) {
+            return false;
         }
 
-        std::vector<Vector3> simplex;
+        Simplex simplex;
+        return Intersect(shapeA, transformA, shapeB, transformB, simplex, cache);
+    }
 
-        // 빈 ConvexHull 체크
+    bool GJK::Intersect(
+        const ConvexHull& shapeA,
+        const Transform& transformA,
+        const ConvexHull& shapeB,
+        const Transform& transformB,
+        Simplex& simplex,
+        GJKCache* cache
+    ) {
+        simplex.clear();
         if (shapeA.vertices.empty() || shapeB.vertices.empty()) {
             return false;
         }
 
-        // 초기 지원점 계산 - 객체 위치 전달
-        Vector3 initialPoint = Support(shapeA, shapeB, direction, posA, posB);
-        simplex.push_back(initialPoint);
+        Vector3 closest;
+        return run(shapeA, transformA, shapeB, transformB, cache, false, simplex, closest);
+    }
+
+    float GJK::Distance(
+        const ConvexHull& shapeA,
+        const Transform& transformA,
+        const ConvexHull& shapeB,
+        const Transform& transformB,
+        GJKDistanceResult& result,
+        GJKCache* cache
+    ) {
+        result = GJKDistanceResult();
+        if (shapeA.vertices.empty() || shapeB.vertices.empty()) {
+            result.distance = std::numeric_limits<float>::max();
+            return result.distance;
+        }
 
-        // 새로운 검색 방향: 원점 방향
-        direction = -initialPoint; // 초기 점에서 원점 방향
+        Simplex simplex;
+        Vector3 closest;
+        result.intersecting = run(shapeA, transformA, shapeB, transformB, cache, true, simplex, closest);
 
-        // 방향 벡터 정규화
-        float dirMag = direction.magnitude();
-        if (dirMag < 1e-10f) {
-            return true; // 초기 점이 원점과 일치하면 충돌 중
+        if (!simplex.isEmpty()) {
+            simplex.computePoints(result.pointA, result.pointB);
         }
-        direction = direction / dirMag;
+        if (!result.intersecting) {
+            // closest = pointA - pointB (B에서 A로), 분리축은 A에서 B로 향하도록 뒤집음
+            result.distance = closest.magnitude();
+            if (result.distance > 0.0f) {
+                result.separatingAxis = -closest / result.distance;
+            }
+        }
+        return result.distance;
+    }
 
-        // 최대 반복 횟수 및 수치 오차 허용값 설정
-        const int MAX_ITERATIONS = 64; // 반복 횟수 증가
-        const float EPSILON = 1e-10f;  // 정밀도 향상
+    bool GJK::Cast(
+        const ConvexHull& shapeA,
+        const Transform& transformA,
+        const ConvexHull& shapeB,
+        const Transform& transformB,
+        const Vector3& translation,
+        GJKCastResult& result,
+        float maxFraction
+    ) {
+        // |v|가 이 거리 이하이면 광선 위의 점 x가 Minkowski 차 표면에 닿았다고 봄
+        static const float CAST_TOLERANCE = 1e-4f;
+        // 광선이 멈춘 채 |v|가 더 줄지 않을 때(float 행렬식 오차의 한계) |v|²가 단순체 크기
+        // (가장 먼 꼭짓점 거리²) 대비 이 비율 이하이면 표면에 닿았다고 봄
+        static const float CAST_RELATIVE_TOLERANCE = 1e-4f;
 
-        int iterationCount = 0;
-        while (iterationCount < MAX_ITERATIONS) {
-            iterationCount++;
+        result = GJKCastResult();
+        if (shapeA.vertices.empty() || shapeB.vertices.empty()) {
+            return false;
+        }
 
-            // 새 지원점 계산 - 객체 위치 전달
-            Vector3 newPoint = Support(shapeA, shapeB, direction, posA, posB);
+        // A가 λ·translation만큼 움직이면 D = A - B도 같이 움직이므로
+        // 원점이 D + λ·translation 안에 드는 것은 -λ·translation이 D 안에 드는 것과 같다.
+        Vector3 ray = -translation;
+        int supportA = -1;
+        int supportB = -1;
+        auto supportPoint = [&](const Vector3& direction, SimplexVertex& vertex) {
+            vertex.a = shapeA.support(direction, transformA, supportA);
+            vertex.b = shapeB.support(-direction, transformB, supportB);
+            vertex.indexA = supportA;
+            vertex.indexB = supportB;
+        };
 
-            // 새 점이 원점을 지나지 못하면 충돌 없음
-            float dotProduct = newPoint.dot(direction);
-            if (dotProduct < -EPSILON) { // 음수 임계값으로 수정
-                return false;
+        float lambda = 0.0f;
+        Vector3 x = Vector3::zero();        // 광선 위의 현재 점 λ·ray
+        Vector3 normal = Vector3::zero();   // 마지막으로 광선을 전진시킨 분리 평면의 법선 (D 바깥 방향)
+        Vector3 v = transformB.position - transformA.position;  // x - (D 안의 점) 근사, 첫 탐색 방향
+        if (v.magnitudeSquared() < 1e-12f) {
+            v = translation;
+        }
+
+        Simplex simplex;
+        SimplexVertex vertex;
+        int iterations = 0;
+        bool converged = false;     // 반복 한도나 단순체 실패가 아니라 수렴 조건으로 멈췄는지
+        while (iterations < MAX_ITERATIONS) {
+            if (v.dot(v) <= CAST_TOLERANCE * CAST_TOLERANCE) {
+                converged = true;
+                break;
             }
+            iterations++;
+            supportPoint(v, vertex);
+            Vector3 p = vertex.a - vertex.b;
 
-            // 새 점 추가
-            simplex.push_back(newPoint);
+            // v에 수직인 지원 평면이 x와 D를 가르면 광선을 그 평면까지 전진
+            bool advanced = false;
+            float vw = v.dot(x - p);
+            if (vw > 0.0f) {
+                float vr = v.dot(ray);
+                if (vr >= 0.0f) {
+                    return false;   // 광선이 평면에서 멀어짐 (이동 방향으로는 닿지 않음)
+                }
+                lambda -= vw / vr;
+                if (lambda > maxFraction) {
+                    return false;
+                }
+                x = ray * lambda;
+                normal = v;
+                advanced = true;
 
-            // 심플렉스가 원점을 포함하는지 확인하고 새 방향 계산
-            if (DoSimplex(simplex, direction)) {
-                return true; // 원점을 포함하므로 충돌
+                // 꼭짓점 w = x - p가 모두 바뀌므로 남은 꼭짓점으로 단순체를 다시 만듦
+                SimplexVertex kept[Simplex::MAX_VERTICES];
+                int keptCount = 0;
+                for (int i = 0; i < Simplex::MAX_VERTICES; ++i) {
+                    if (simplex.getBits() & (1u << i)) {
+                        kept[keptCount] = simplex.getVertex(i);
+                        kept[keptCount].w = x - (kept[keptCount].a - kept[keptCount].b);
+                        keptCount++;
+                    }
+                }
+                simplex.clear();
+                for (int i = 0; i < keptCount; ++i) {
+                    simplex.push(kept[i]);
+                }
             }
 
-            // 방향 벡터 정규화
-            dirMag = direction.magnitude();
-            if (dirMag < EPSILON) {
-                return false; // 방향 벡터가 너무 작으면 이전에 검사한 것과 동일
+            // 광선이 멈춰 있는 동안 |v|는 줄어들기만 해야 하므로, 같은 지원점이 다시 나오거나
+            // |v|가 줄지 않으면 더 가까워질 수 없음 (GJK::solve의 거리 모드와 같은 판단)
+            vertex.w = x - p;
+            if (!advanced && simplex.containsActive(vertex.w)) {
+                converged = v.dot(v) <= CAST_RELATIVE_TOLERANCE * simplex.maxLengthSquared();
+                break;
+            }
+            uint32_t previousBits = simplex.getBits();
+            Vector3 previous = v;
+            if (!simplex.containsActive(vertex.w)) {
+                simplex.add(vertex);
+            }
+            // x가 옮겨 가면 가장 가까운 부분 단순체가 새 꼭짓점을 빠뜨릴 수 있으므로 모든 부분 집합을 검사
+            if (!simplex.closestAny(v)) {
+                break;
             }
-            direction = direction / dirMag;
+            if (!advanced && previousBits != 0 && !simplex.isFull() && v.dot(v) >= previous.dot(previous)) {
+                simplex.restore(previousBits);
+                v = previous;
+                converged = v.dot(v) <= CAST_RELATIVE_TOLERANCE * simplex.maxLengthSquared();
+                break;
+            }
+            if (simplex.isFull()) {
+                converged = true;
+                break;      // 사면체가 x를 감쌈 (처음부터 겹침)
+            }
+        }
+        // 반복 한도에 걸리거나 단순체 계산이 실패하면 λ는 처음 닿는 비율의 하한일 뿐
+        // 그 자세에서 두 도형은 떨어져 있으므로 충돌로 보지 않음
+        if (!converged) {
+            return false;
         }
 
-        // 최대 반복 횟수에 도달하면 결과 결정
-        // 더 견고한 구현을 위해 심플렉스와 원점 간 거리 계산
-        return calculateDistanceToOrigin(simplex) < EPSILON;
+        result.hit = true;
+        result.fraction = lambda;
+        float length = normal.magnitude();
+        if (length > 0.0f) {
+            result.normal = -normal / length;
+        } else {
+            result.normal = translation.magnitudeSquared() > 0.0f ? -translation.normalized() : Vector3(0, 1, 0);
+        }
+        if (!simplex.isEmpty()) {
+            simplex.computePoints(result.pointA, result.pointB);
+            result.pointA += translation * lambda;
+        }
+        return true;
     }
 
+    bool GJK::run(
+        const ConvexHull& shapeA, const Transform& transformA,
+        const ConvexHull& shapeB, const Transform& transformB,
+        GJKCache* cache, bool untilClosest, Simplex& simplex, Vector3& closest
+    ) {
+        // 캐시가 없어도 반복 사이의 지원점은 서로 가까우므로 지역 캐시 사용
+        GJKCache localCache;
+        GJKCache& supportCache = cache != nullptr ? *cache : localCache;
+
+        bool warm = supportCache.hasDirection || supportCache.simplexCount == 4;
+        int iterations = 0;
+        bool result;
 
-    // 원점과 심플렉스 간 거리 계산
-    float GJK::calculateDistanceToOrigin(const std::vector<Vector3>& simplex) {
-        // 단순 구현: 심플렉스의 모든 점에서 원점까지의 최소 거리
-        float minDistSq = std::numeric_limits<float>::max();
-        
-        for (const auto& point : simplex) {
-            float distSq = point.magnitudeSquared();
-            if (distSq < minDistSq) {
-                minDistSq = distSq;
+        if (supportCache.simplexCount == 4 &&
+            loadCachedSimplex(shapeA, transformA, shapeB, transformB, supportCache, simplex)) {
+            // 지난 프레임의 사면체가 아직 원점을 감싸므로 반복 없이 충돌
+            closest = Vector3::zero();
+            result = true;
+        } else {
+            Vector3 direction;
+            if (supportCache.hasDirection) {
+                // 지난 프레임의 탐색(분리) 방향에서 시작
+                direction = supportCache.direction;
+            } else {
+                // 초기 방향: B에서 A 방향 (보통 더 잘 수렴)
+                direction = (transformA.position - transformB.position).normalized();
+                if (direction.magnitudeSquared() < 1e-6f) {
+                    direction = Vector3(1, 0, 0); // 방향이 너무 작으면 기본값 사용
+                }
             }
+            result = solve(shapeA, transformA, shapeB, transformB, direction, supportCache,
+                           untilClosest, simplex, closest, iterations);
         }
-        
-        return std::sqrt(minDistSq);
-    }
 
-
-    bool GJK::DoSimplex(std::vector<Vector3>& simplex, Vector3& direction) {
-        switch (simplex.size()) {
-            case 2: return doLine(simplex, direction);
-            case 3: return doTriangle(simplex, direction);
-            case 4: return doTetrahedron(simplex, direction);
-            default: return false;
-        }
-    }
-    
-    // 선분 처리 (2점 심플렉스)
-    bool GJK::doLine(std::vector<Vector3>& simplex, Vector3& direction) {
-        Vector3 A = simplex[1]; // 마지막에 추가된 점
-        Vector3 B = simplex[0]; // 이전 점
-        Vector3 AB = B - A;     // B에서 A로의 벡터
-        Vector3 AO = -A;        // A에서 원점으로의 벡터
-        
-        // AB 방향의 보로노이 영역에 원점이 있는지 확인
-        if (AB.dot(AO) > 0) {
-            // AB 방향으로 진행하되, AB⊥AO 방향으로 검색
-            direction = AB.cross(AO).cross(AB);
-            
-            // 방향 벡터가 너무 작으면 임의의 수직 벡터 생성
-            if (direction.magnitudeSquared() < 1e-6f) {
-                // AB에 수직인 방향 찾기
-                if (std::abs(AB.x) > std::abs(AB.y))
-                    direction = Vector3(-AB.z, 0, AB.x);
-                else
-                    direction = Vector3(0, -AB.z, AB.y);
+        // 반복 통계
+        stats.calls++;
+        stats.iterations += iterations;
+        if (warm) {
+            stats.warmStarts++;
+            if (supportCache.coldIterations > iterations) {
+                stats.savedIterations += supportCache.coldIterations - iterations;
             }
         } else {
-            // A를 유지하고 B 제거
-            simplex.erase(simplex.begin()); // B 제거
-            direction = AO; // 원점 방향
+            supportCache.coldIterations = iterations;
         }
-        
-        return false; // 원점이 아직 포함되지 않음
-    }
-    
-    // 삼각형 처리 (3점 심플렉스)
-    bool GJK::doTriangle(std::vector<Vector3>& simplex, Vector3& direction) {
-        Vector3 A = simplex[2]; // 마지막 점
-        Vector3 B = simplex[1]; 
-        Vector3 C = simplex[0]; // 첫 점
-        
-        Vector3 AB = B - A;
-        Vector3 AC = C - A;
-        Vector3 AO = -A; // A에서 원점으로
-        
-        Vector3 ABCnormal = AB.cross(AC); // 삼각형 법선
-        Vector3 ABperp = AB.cross(ABCnormal); // AB에 수직, ABC 평면 위
-        Vector3 ACperp = ABCnormal.cross(AC); // AC에 수직, ABC 평면 위
-        
-        // AB 엣지의 보로노이 영역 확인
-        if (ABperp.dot(AO) > 0) {
-            // AB 엣지의 보로노이 영역에 원점이 있음
-            simplex.erase(simplex.begin()); // C 제거
-            return doLine(simplex, direction); // 선분으로 축소
-        }
-        
-        // AC 엣지의 보로노이 영역 확인
-        if (ACperp.dot(AO) > 0) {
-            // AC 엣지의 보로노이 영역에 원점이 있음
-            simplex.erase(simplex.begin() + 1); // B 제거
-            return doLine(simplex, direction); // 선분으로 축소
-        }
-        
-        // 삼각형 "위" 또는 "아래" 확인
-        if (ABCnormal.dot(AO) > 0) {
-            // 삼각형 "위"에 원점이 있음
-            direction = ABCnormal;
-        } else {
-            // 삼각형 "아래"에 원점이 있음
-            std::swap(simplex[0], simplex[1]); // B와 C 교체하여 일관된 방향 유지
-            direction = -ABCnormal;
-        }
-        
-        return false; // 아직 원점 포함 안됨
+
+        return result;
     }
-    
-    // 사면체 처리 (4점 심플렉스)
-    bool GJK::doTetrahedron(std::vector<Vector3>& simplex, Vector3& direction) {
-        Vector3 A = simplex[3]; // 마지막 점
-        Vector3 B = simplex[2];
-        Vector3 C = simplex[1];
-        Vector3 D = simplex[0]; // 첫 점
-        
-        Vector3 AO = -A; // A에서 원점으로
-        
-        // 사면체의 각 면 확인
-        Vector3 ABC = (B - A).cross(C - A);
-        Vector3 ACD = (C - A).cross(D - A);
-        Vector3 ADB = (D - A).cross(B - A);
-        
-        // 각 면의 바깥쪽을 향하는지 확인
-        bool ABCout = ABC.dot(AO) > 0;
-        bool ACDout = ACD.dot(AO) > 0;
-        bool ADBout = ADB.dot(AO) > 0;
-        
-        // 모든 면에 대해 원점이 같은 쪽에 있는지 확인
-        if (ABCout && ACDout && ADBout) {
-            // 넷째 면 BCD도 확인
-            Vector3 BDC = (D - B).cross(C - B);
-            if (BDC.dot(B) > 0) { // B에서 원점 방향
-                // 원점이 사면체 내부에 있음
+
+    bool GJK::solve(
+        const ConvexHull& shapeA, const Transform& transformA,
+        const ConvexHull& shapeB, const Transform& transformB,
+        Vector3 direction, GJKCache& supportCache,
+        bool untilClosest, Simplex& simplex, Vector3& v, int& iterations
+    ) {
+        // |v|²가 단순체 꼭짓점 길이 제곱의 이 비율 이하이면 원점이 단순체 위에 있다고 봄
+        static const float RELATIVE_EPSILON = 1e-10f;
+        // 거리 모드 수렴 조건: |v|² - v·w <= DISTANCE_TOLERANCE * |v|² (v가 최근접점에 충분히 가까움)
+        static const float DISTANCE_TOLERANCE = 1e-6f;
+
+        v = -direction;             // 원점에 가장 가까운 단순체 위의 점 (탐색 방향은 -v)
+        bool separated = false;     // 분리가 이미 확인되었는지 (거리 모드)
+        iterations = 0;
+
+        while (iterations < MAX_ITERATIONS) {
+            iterations++;
+            direction = -v;
+
+            SimplexVertex vertex;
+            vertex.a = shapeA.support(direction, transformA, supportCache.supportA);
+            vertex.b = shapeB.support(v, transformB, supportCache.supportB);
+            vertex.indexA = supportCache.supportA;
+            vertex.indexB = supportCache.supportB;
+            vertex.w = vertex.a - vertex.b;
+
+            // -v 방향 지원점이 원점을 넘지 못하면 v에 수직인 평면이 두 볼록체를 분리
+            // 거리 모드에서는 분리가 확인된 뒤에도 v가 최근접점으로 수렴할 때까지 계속
+            float vw = v.dot(vertex.w);
+            if (vw > 0.0f) {
+                float vv = v.dot(v);
+                if (!untilClosest || (!simplex.isEmpty() && vv - vw <= DISTANCE_TOLERANCE * vv)) {
+                    supportCache.direction = direction.normalized();
+                    supportCache.hasDirection = true;
+                    supportCache.simplexCount = 0;
+                    return false;
+                }
+                separated = true;
+            }
+
+            // 이미 있는 지원점이 다시 나오거나 부분 단순체를 고를 수 없으면 더 가까워질 수 없음
+            // (불리언 검사에서는 경계 접촉, 거리 모드에서는 현재 v가 최근접점)
+            if (simplex.contains(vertex.w)) {
+                break;
+            }
+            uint32_t previousBits = simplex.getBits();
+            Vector3 previous = v;
+            simplex.add(vertex);
+            if (!simplex.closest(v)) {
+                break;
+            }
+
+            // 분리가 확인된 뒤에는 원점을 감쌀 수 없고 |v|는 줄어들기만 해야 한다.
+            // 거의 평평한 사면체의 수치 오차로 그렇지 않으면 직전 단순체를 최근접 결과로 사용
+            if (separated && previousBits != 0 && (simplex.isFull() || v.dot(v) >= previous.dot(previous))) {
+                simplex.restore(previousBits);
+                v = previous;
+                break;
+            }
+
+            // 사면체가 원점을 감싸거나 가장 가까운 점이 원점이면 충돌
+            if (simplex.isFull() || v.dot(v) <= RELATIVE_EPSILON * simplex.maxLengthSquared()) {
+                supportCache.direction = direction.normalized();
+                supportCache.hasDirection = true;
+                supportCache.simplexCount = 0;
+                for (int i = 0; i < Simplex::MAX_VERTICES; ++i) {
+                    if (simplex.getBits() & (1u << i)) {
+                        const SimplexVertex& corner = simplex.getVertex(i);
+                        supportCache.simplexA[supportCache.simplexCount] = corner.indexA;
+                        supportCache.simplexB[supportCache.simplexCount] = corner.indexB;
+                        supportCache.simplexCount++;
+                    }
+                }
                 return true;
             }
         }
-        
-        // 원점이 어느 면의 바깥쪽에 있으면, 그 면을 향해 진행
-        if (ABCout) {
-            simplex.erase(simplex.begin()); // D 제거
-            direction = ABC;
-            return doTriangle(simplex, direction);
+
+        supportCache.direction = direction.normalized();
+        supportCache.hasDirection = true;
+        supportCache.simplexCount = 0;
+        return false;
+    }
+
+    // 캐시된 정점 인덱스로 사면체를 다시 만들어 네 면 모두에서 원점이 반대 꼭짓점 쪽에 있는지 확인
+    bool GJK::loadCachedSimplex(
+        const ConvexHull& shapeA, const Transform& transformA,
+        const ConvexHull& shapeB, const Transform& transformB,
+        const GJKCache& cache, Simplex& simplex
+    ) const {
+        SimplexVertex corners[4];
+        for (int i = 0; i < 4; ++i) {
+            int a = cache.simplexA[i];
+            int b = cache.simplexB[i];
+            if (a < 0 || b < 0 ||
+                a >= static_cast<int>(shapeA.vertices.size()) || b >= static_cast<int>(shapeB.vertices.size())) {
+                return false;
+            }
+            corners[i].a = transformA.transformPoint(shapeA.vertices[a]);
+            corners[i].b = transformB.transformPoint(shapeB.vertices[b]);
+            corners[i].w = corners[i].a - corners[i].b;
+            corners[i].indexA = a;
+            corners[i].indexB = b;
         }
-        
-        if (ACDout) {
-            simplex.erase(simplex.begin() + 2); // B 제거
-            direction = ACD;
-            return doTriangle(simplex, direction);
+
+        static const int faces[4][4] = { {0, 1, 2, 3}, {0, 1, 3, 2}, {0, 2, 3, 1}, {1, 2, 3, 0} };
+        for (const auto& face : faces) {
+            const Vector3& p = corners[face[0]].w;
+            Vector3 normal = (corners[face[1]].w - p).cross(corners[face[2]].w - p);
+            float opposite = normal.dot(corners[face[3]].w - p);
+            float origin = -normal.dot(p);
+            if (std::abs(opposite) < 1e-12f || opposite * origin < 0.0f) {
+                return false;
+            }
         }
-        
-        if (ADBout) {
-            simplex.erase(simplex.begin() + 1); // C 제거
-            direction = ADB;
-            return doTriangle(simplex, direction);
+
+        simplex.clear();
+        for (const SimplexVertex& corner : corners) {
+            simplex.push(corner);
         }
-        
-        // 여기까지 왔다면 원점이 사면체 내부에 있음
         return true;
     }
 
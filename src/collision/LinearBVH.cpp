@@ -0,0 +1,359 @@
+#include "LinearBVH.h"
+#include <algorithm>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace Collision {
+
+namespace {
+
+    const int RADIX_BITS = 8;
+    const int RADIX_BUCKETS = 1 << RADIX_BITS;
+    const int RADIX_PASSES = 4;         // 30비트 코드를 8비트씩 4번
+
+    inline int maxThreadCount() {
+#ifdef _OPENMP
+        return omp_get_max_threads();
+#else
+        return 1;
+#endif
+    }
+
+    inline int threadCount() {
+#ifdef _OPENMP
+        return omp_get_num_threads();
+#else
+        return 1;
+#endif
+    }
+
+    inline int threadIndex() {
+#ifdef _OPENMP
+        return omp_get_thread_num();
+#else
+        return 0;
+#endif
+    }
+
+    // 두 AABB의 합집합을 임시 객체 없이 out에 기록
+    inline void mergeInto(AABB& out, const AABB& a, const AABB& b) {
+        out.min.x = std::min(a.min.x, b.min.x);
+        out.min.y = std::min(a.min.y, b.min.y);
+        out.min.z = std::min(a.min.z, b.min.z);
+        out.max.x = std::max(a.max.x, b.max.x);
+        out.max.y = std::max(a.max.y, b.max.y);
+        out.max.z = std::max(a.max.z, b.max.z);
+    }
+
+    inline int countLeadingZeros(uint32_t v) {
+        if (v == 0) {
+            return 32;
+        }
+#ifdef _MSC_VER
+        unsigned long index;
+        _BitScanReverse(&index, v);
+        return 31 - static_cast<int>(index);
+#else
+        return __builtin_clz(v);
+#endif
+    }
+
+} // namespace
+
+// 10비트 값의 각 비트 사이에 0 두 개를 끼워 넣음
+uint32_t LinearBVH::expandBits(uint32_t v) {
+    v = (v * 0x00010001u) & 0xFF0000FFu;
+    v = (v * 0x00000101u) & 0x0F00F00Fu;
+    v = (v * 0x00000011u) & 0xC30C30C3u;
+    v = (v * 0x00000005u) & 0x49249249u;
+    return v;
+}
+
+// [0, 1] 범위의 좌표를 10비트로 양자화해 30비트 Morton 코드 생성
+uint32_t LinearBVH::mortonCode(float x, float y, float z) {
+    x = std::min(std::max(x * 1024.0f, 0.0f), 1023.0f);
+    y = std::min(std::max(y * 1024.0f, 0.0f), 1023.0f);
+    z = std::min(std::max(z * 1024.0f, 0.0f), 1023.0f);
+    uint32_t xx = expandBits(static_cast<uint32_t>(x));
+    uint32_t yy = expandBits(static_cast<uint32_t>(y));
+    uint32_t zz = expandBits(static_cast<uint32_t>(z));
+    return (xx << 2) | (yy << 1) | zz;
+}
+
+void LinearBVH::clear() {
+    nodes.clear();
+    mortonCodes.clear();
+    sortedPrimitives.clear();
+    leafCount = 0;
+}
+
+void LinearBVH::build(const AABBSoA& bounds) {
+    leafCount = bounds.size();
+    if (leafCount == 0) {
+        nodes.clear();
+        return;
+    }
+
+    const int n = static_cast<int>(leafCount);
+
+    // 1. 중심점 범위 계산
+    // (중심점 대신 min + max를 사용해 0.5 곱셈 생략)
+    const float* bMinX = bounds.minX.data();
+    const float* bMinY = bounds.minY.data();
+    const float* bMinZ = bounds.minZ.data();
+    const float* bMaxX = bounds.maxX.data();
+    const float* bMaxY = bounds.maxY.data();
+    const float* bMaxZ = bounds.maxZ.data();
+
+    float minX = bMinX[0] + bMaxX[0];
+    float minY = bMinY[0] + bMaxY[0];
+    float minZ = bMinZ[0] + bMaxZ[0];
+    float maxX = minX, maxY = minY, maxZ = minZ;
+    #pragma omp parallel for reduction(min:minX, minY, minZ) reduction(max:maxX, maxY, maxZ)
+    for (int i = 0; i < n; ++i) {
+        float cx = bMinX[i] + bMaxX[i];
+        float cy = bMinY[i] + bMaxY[i];
+        float cz = bMinZ[i] + bMaxZ[i];
+        minX = std::min(minX, cx); minY = std::min(minY, cy); minZ = std::min(minZ, cz);
+        maxX = std::max(maxX, cx); maxY = std::max(maxY, cy); maxZ = std::max(maxZ, cz);
+    }
+
+    float scaleX = (maxX > minX) ? 1.0f / (maxX - minX) : 0.0f;
+    float scaleY = (maxY > minY) ? 1.0f / (maxY - minY) : 0.0f;
+    float scaleZ = (maxZ > minZ) ? 1.0f / (maxZ - minZ) : 0.0f;
+
+    // 2. Morton 코드 계산
+    mortonCodes.resize(leafCount);
+    sortedPrimitives.resize(leafCount);
+    #pragma omp parallel for
+    for (int i = 0; i < n; ++i) {
+        float cx = bMinX[i] + bMaxX[i];
+        float cy = bMinY[i] + bMaxY[i];
+        float cz = bMinZ[i] + bMaxZ[i];
+        mortonCodes[i] = mortonCode((cx - minX) * scaleX, (cy - minY) * scaleY, (cz - minZ) * scaleZ);
+        sortedPrimitives[i] = static_cast<uint32_t>(i);
+    }
+
+    // 3. 코드 기준 병렬 기수 정렬
+    radixSort();
+
+    // 4. 내부 노드별 독립적으로 자식 결정 (Karras 2012)
+    nodes.resize(2 * leafCount - 1);
+    buildHierarchy();
+
+    // 5. 리프에서 루트 방향으로 AABB 계산
+    computeBounds(bounds);
+}
+
+// LSD 기수 정렬: 스레드별 히스토그램 -> (자릿수, 스레드) 순 누적합 -> 안정 분배
+void LinearBVH::radixSort() {
+    const size_t n = leafCount;
+    keyScratch.resize(n);
+    valueScratch.resize(n);
+    histograms.resize(static_cast<size_t>(maxThreadCount()) * RADIX_BUCKETS);
+
+    uint32_t* keysIn = mortonCodes.data();
+    uint32_t* valuesIn = sortedPrimitives.data();
+    uint32_t* keysOut = keyScratch.data();
+    uint32_t* valuesOut = valueScratch.data();
+
+    for (int pass = 0; pass < RADIX_PASSES; ++pass) {
+        const int shift = pass * RADIX_BITS;
+
+        #pragma omp parallel
+        {
+            const int t = threadIndex();
+            const int threads = threadCount();
+            const size_t begin = n * t / threads;
+            const size_t end = n * (t + 1) / threads;
+            uint32_t* hist = &histograms[static_cast<size_t>(t) * RADIX_BUCKETS];
+
+            std::fill(hist, hist + RADIX_BUCKETS, 0u);
+            for (size_t i = begin; i < end; ++i) {
+                hist[(keysIn[i] >> shift) & (RADIX_BUCKETS - 1)]++;
+            }
+
+            #pragma omp barrier
+            #pragma omp single
+            {
+                uint32_t sum = 0;
+                for (int digit = 0; digit < RADIX_BUCKETS; ++digit) {
+                    for (int th = 0; th < threads; ++th) {
+                        uint32_t& slot = histograms[static_cast<size_t>(th) * RADIX_BUCKETS + digit];
+                        uint32_t count = slot;
+                        slot = sum;
+                        sum += count;
+                    }
+                }
+            }
+
+            for (size_t i = begin; i < end; ++i) {
+                uint32_t pos = hist[(keysIn[i] >> shift) & (RADIX_BUCKETS - 1)]++;
+                keysOut[pos] = keysIn[i];
+                valuesOut[pos] = valuesIn[i];
+            }
+        }
+
+        std::swap(keysIn, keysOut);
+        std::swap(valuesIn, valuesOut);
+    }
+    // 짝수 번 교체했으므로 결과는 mortonCodes / sortedPrimitives에 있음
+}
+
+int LinearBVH::commonPrefix(int i, int j) const {
+    if (j < 0 || j >= static_cast<int>(leafCount)) {
+        return -1;
+    }
+    uint32_t a = mortonCodes[i];
+    uint32_t b = mortonCodes[j];
+    if (a == b) {
+        return 32 + countLeadingZeros(static_cast<uint32_t>(i) ^ static_cast<uint32_t>(j));
+    }
+    return countLeadingZeros(a ^ b);
+}
+
+// 내부 노드 i가 덮는 정렬 구간 [i, j]와 분할 위치를 이진 탐색으로 결정
+void LinearBVH::buildHierarchy() {
+    const int n = static_cast<int>(leafCount);
+    const int firstLeaf = n - 1;
+
+    #pragma omp parallel for
+    for (int k = 0; k < n; ++k) {
+        LBVHNode& leaf = nodes[firstLeaf + k];
+        leaf.left = -1;
+        leaf.right = -1;
+        leaf.parent = -1;
+        leaf.primitive = static_cast<int>(sortedPrimitives[k]);
+    }
+
+    #pragma omp parallel for
+    for (int i = 0; i < n - 1; ++i) {
+        // 구간 방향: 공통 접두사가 더 긴 이웃 쪽
+        int d = (commonPrefix(i, i + 1) - commonPrefix(i, i - 1)) >= 0 ? 1 : -1;
+        int deltaMin = commonPrefix(i, i - d);
+
+        // 구간 길이 상한을 두 배씩 늘려 찾은 뒤 이진 탐색
+        int lengthMax = 2;
+        while (commonPrefix(i, i + lengthMax * d) > deltaMin) {
+            lengthMax *= 2;
+        }
+        int length = 0;
+        for (int t = lengthMax / 2; t >= 1; t /= 2) {
+            if (commonPrefix(i, i + (length + t) * d) > deltaMin) {
+                length += t;
+            }
+        }
+        int j = i + length * d;
+
+        // 공통 접두사가 처음 달라지는 분할 위치 탐색
+        int deltaNode = commonPrefix(i, j);
+        int split = 0;
+        int t = length;
+        do {
+            t = (t + 1) >> 1;
+            if (commonPrefix(i, i + (split + t) * d) > deltaNode) {
+                split += t;
+            }
+        } while (t > 1);
+        int gamma = i + split * d + std::min(d, 0);
+
+        int left = (std::min(i, j) == gamma) ? firstLeaf + gamma : gamma;
+        int right = (std::max(i, j) == gamma + 1) ? firstLeaf + gamma + 1 : gamma + 1;
+
+        LBVHNode& node = nodes[i];
+        node.left = left;
+        node.right = right;
+        node.primitive = -1;
+        nodes[left].parent = i;
+        nodes[right].parent = i;
+    }
+
+    if (n > 1) {
+        nodes[0].parent = -1;
+    }
+}
+
+// 각 리프에서 위로 올라가며 두 번째로 도착한 스레드가 부모 AABB를 계산
+void LinearBVH::computeBounds(const AABBSoA& bounds) {
+    const int n = static_cast<int>(leafCount);
+    const int firstLeaf = n - 1;
+
+    if (visitCapacity < leafCount) {
+        visitCounters.reset(new std::atomic<int>[leafCount]);
+        visitCapacity = leafCount;
+    }
+
+    #pragma omp parallel for
+    for (int i = 0; i < n - 1; ++i) {
+        visitCounters[i].store(0, std::memory_order_relaxed);
+    }
+
+    #pragma omp parallel for
+    for (int k = 0; k < n; ++k) {
+        LBVHNode& leaf = nodes[firstLeaf + k];
+        leaf.bounds = bounds.get(leaf.primitive);
+
+        int node = leaf.parent;
+        while (node >= 0) {
+            // 먼저 도착한 쪽은 형제의 AABB가 아직 없으므로 종료
+            if (visitCounters[node].fetch_add(1, std::memory_order_acq_rel) == 0) {
+                break;
+            }
+            LBVHNode& parent = nodes[node];
+            mergeInto(parent.bounds, nodes[parent.left].bounds, nodes[parent.right].bounds);
+            node = parent.parent;
+        }
+    }
+}
+
+// 각 리프가 자기 AABB로 트리를 질의하고, 자신보다 뒤에 있는 리프와의 쌍만 보고
+void LinearBVH::findCollisionPairs(std::vector<std::pair<int, int>>& pairs) {
+    if (leafCount < 2) {
+        return;
+    }
+
+    const int n = static_cast<int>(leafCount);
+    const int firstLeaf = n - 1;
+
+    threadPairs.resize(static_cast<size_t>(maxThreadCount()));
+    for (auto& local : threadPairs) {
+        local.clear();
+    }
+
+    #pragma omp parallel for schedule(dynamic, 256)
+    for (int k = 0; k < n; ++k) {
+        std::vector<std::pair<int, int>>& local = threadPairs[threadIndex()];
+        const int self = firstLeaf + k;
+        const AABB& aabb = nodes[self].bounds;
+
+        int stack[MAX_STACK];
+        int top = 0;
+        stack[top++] = 0;
+
+        while (top > 0) {
+            int index = stack[--top];
+            const LBVHNode& node = nodes[index];
+            if (!node.bounds.intersects(aabb)) {
+                continue;
+            }
+            if (node.isLeaf()) {
+                if (index > self) {
+                    local.emplace_back(nodes[self].primitive, node.primitive);
+                }
+            } else {
+                stack[top++] = node.right;
+                stack[top++] = node.left;
+            }
+        }
+    }
+
+    for (const auto& local : threadPairs) {
+        pairs.insert(pairs.end(), local.begin(), local.end());
+    }
+}
+
+} // namespace Collision
@@ -0,0 +1,198 @@
+#include "PairManager.h"
+#include <utility>
+
+namespace Collision {
+
+    namespace {
+
+        // 특징 ID가 바뀐 접촉점을 지난 프레임 점과 같은 점으로 볼 A 로컬 거리
+        const float CONTACT_MATCH_DISTANCE = 0.02f;
+
+    } // namespace
+
+    void PairManager::clear() {
+        pairs.clear();
+        table.clear();
+        manifolds.clear();
+        freeManifolds.clear();
+        hullCaches.clear();
+        freeHullCaches.clear();
+    }
+
+    // key가 있는 슬롯 또는 탐사가 끝난 빈 슬롯
+    size_t PairManager::findSlot(uint64_t key) const {
+        size_t mask = table.size() - 1;
+        size_t slot = hashKey(key) & mask;
+        while (table[slot] != EMPTY && pairs[table[slot]].key != key) {
+            slot = (slot + 1) & mask;
+        }
+        return slot;
+    }
+
+    // 적재율이 1/2을 넘지 않도록 테이블을 두 배로 늘리고 다시 채움
+    void PairManager::grow() {
+        size_t capacity = table.empty() ? 64 : table.size() * 2;
+        table.assign(capacity, EMPTY);
+
+        size_t mask = capacity - 1;
+        for (uint32_t i = 0; i < pairs.size(); ++i) {
+            size_t slot = hashKey(pairs[i].key) & mask;
+            while (table[slot] != EMPTY) {
+                slot = (slot + 1) & mask;
+            }
+            table[slot] = i;
+        }
+    }
+
+    CollisionPair* PairManager::find(uint32_t idA, uint32_t idB) {
+        if (table.empty()) {
+            return nullptr;
+        }
+        size_t slot = findSlot(makeKey(idA, idB));
+        return table[slot] == EMPTY ? nullptr : &pairs[table[slot]];
+    }
+
+    CollisionPair& PairManager::touch(Object3D* a, uint32_t idA, Object3D* b, uint32_t idB, bool& isNew) {
+        if ((pairs.size() + 1) * 2 > table.size()) {
+            grow();
+        }
+
+        uint64_t key = makeKey(idA, idB);
+        size_t slot = findSlot(key);
+
+        isNew = table[slot] == EMPTY;
+        if (isNew) {
+            CollisionPair pair;
+            pair.key = key;
+            pair.objectA = idA < idB ? a : b;
+            pair.objectB = idA < idB ? b : a;
+            pair.colliding = false;
+            pair.manifoldIndex = -1;
+            pair.hullCacheIndex = -1;
+            table[slot] = static_cast<uint32_t>(pairs.size());
+            pairs.push_back(std::move(pair));
+        }
+
+        CollisionPair& pair = pairs[table[slot]];
+        pair.lastFrame = frame;
+        return pair;
+    }
+
+    const ContactManifold& PairManager::updateManifold(CollisionPair& pair, const ContactManifold& fresh) {
+        if (pair.manifoldIndex < 0) {
+            if (!freeManifolds.empty()) {
+                pair.manifoldIndex = freeManifolds.back();
+                freeManifolds.pop_back();
+            } else {
+                pair.manifoldIndex = static_cast<int>(manifolds.size());
+                manifolds.emplace_back();
+            }
+            manifolds[pair.manifoldIndex].clear();
+        }
+
+        ContactManifold& manifold = manifolds[pair.manifoldIndex];
+        manifold.merge(fresh, CONTACT_MATCH_DISTANCE);
+        return manifold;
+    }
+
+    void PairManager::releaseManifold(CollisionPair& pair) {
+        if (pair.manifoldIndex >= 0) {
+            manifolds[pair.manifoldIndex].clear();
+            freeManifolds.push_back(pair.manifoldIndex);
+            pair.manifoldIndex = -1;
+        }
+    }
+
+    HullPairCache& PairManager::hullCache(CollisionPair& pair, int hullA, int hullB) {
+        int cursor = pair.hullCacheIndex;
+        int found = -1;
+        int stale = -1;
+        if (cursor >= 0) {
+            int start = hullCaches[cursor].next;
+            int index = start;
+            do {
+                const HullPairCache& entry = hullCaches[index];
+                if (entry.hullA == hullA && entry.hullB == hullB) {
+                    found = index;
+                    break;
+                }
+                // 지난 프레임에도 쓰지 않은 항목은 다른 껍질 쌍에 넘겨줄 수 있음
+                if (stale < 0 && frame - entry.lastFrame > 1) {
+                    stale = index;
+                }
+                index = entry.next;
+            } while (index != start);
+        }
+
+        if (found < 0) {
+            if (stale >= 0) {
+                found = stale;
+            } else {
+                if (!freeHullCaches.empty()) {
+                    found = freeHullCaches.back();
+                    freeHullCaches.pop_back();
+                } else {
+                    found = static_cast<int>(hullCaches.size());
+                    hullCaches.emplace_back();
+                }
+                // 커서 바로 뒤에 끼워 넣어 다음 프레임에 같은 순서로 찾게 함
+                if (cursor >= 0) {
+                    hullCaches[found].next = hullCaches[cursor].next;
+                    hullCaches[cursor].next = found;
+                } else {
+                    hullCaches[found].next = found;
+                }
+            }
+            HullPairCache& entry = hullCaches[found];
+            entry.hullA = hullA;
+            entry.hullB = hullB;
+            entry.gjk = GJKCache();
+            entry.sat = SATCache();
+        }
+
+        pair.hullCacheIndex = found;
+        hullCaches[found].lastFrame = frame;
+        return hullCaches[found];
+    }
+
+    void PairManager::releaseHullCaches(CollisionPair& pair) {
+        int start = pair.hullCacheIndex;
+        if (start < 0) {
+            return;
+        }
+        int index = start;
+        do {
+            freeHullCaches.push_back(index);
+            index = hullCaches[index].next;
+        } while (index != start);
+        pair.hullCacheIndex = -1;
+    }
+
+    // 쌍 제거: 슬롯은 뒤쪽 항목을 당겨 채우고(backward shift), dense 배열은 마지막 원소와 교체
+    void PairManager::removeAt(size_t index) {
+        releaseManifold(pairs[index]);
+        releaseHullCaches(pairs[index]);
+        size_t mask = table.size() - 1;
+        size_t slot = findSlot(pairs[index].key);
+
+        size_t next = (slot + 1) & mask;
+        while (table[next] != EMPTY) {
+            size_t home = hashKey(pairs[table[next]].key) & mask;
+            // next 항목의 원래 위치가 (slot, next] 구간 밖이면 slot으로 옮길 수 있음
+            if (((next - home) & mask) >= ((next - slot) & mask)) {
+                table[slot] = table[next];
+                slot = next;
+            }
+            next = (next + 1) & mask;
+        }
+        table[slot] = EMPTY;
+
+        size_t last = pairs.size() - 1;
+        if (index != last) {
+            table[findSlot(pairs[last].key)] = static_cast<uint32_t>(index);
+            pairs[index] = std::move(pairs[last]);
+        }
+        pairs.pop_back();
+    }
+
+} // namespace Collision
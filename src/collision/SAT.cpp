@@ -5,61 +5,280 @@
 
 namespace Collision {
 
-    // OverlapOnAxis: 주어진 축(axis)에 대해, OBB의 모든 정점(projection)을 구한 후 겹침 여부를 판단
-    bool SAT::OverlapOnAxis(const OBB& obbA, const OBB& obbB, const Vector3& axis) {
-        // 주어진 축을 단위 벡터로 만듭니다.
-        Vector3 axisNorm = axis.normalized();
-
-        // 람다 함수: 해당 OBB의 모든 정점을 주어진 축에 투영하여 [min, max] 범위를 반환
-        auto getProjection = [&](const OBB& obb) -> std::pair<float, float> {
-            float minProj = std::numeric_limits<float>::infinity();
-            float maxProj = -std::numeric_limits<float>::infinity();
-            // OBB의 정점은 getCorners() 함수로 구합니다.
-            for (const Vector3& vertex : obb.getCorners()) {
-                float proj = vertex.dot(axisNorm);
-                minProj = std::min(minProj, proj);
-                maxProj = std::max(maxProj, proj);
-            }
-            return std::make_pair(minProj, maxProj);
-        };
+    namespace {
 
-        auto [minA, maxA] = getProjection(obbA);
-        auto [minB, maxB] = getProjection(obbB);
+        // 최소 침투 축을 고를 때 면 축을 변 축보다, A 면을 B 면보다 조금 우선 (접촉 다각형이 프레임마다 뒤바뀌지 않도록)
+        const float RELATIVE_TOLERANCE = 0.98f;
+        const float ABSOLUTE_TOLERANCE = 1e-3f;
 
-        // 두 프로젝션 구간이 겹치는지 검사
-        return (maxA >= minB) && (maxB >= minA);
-    }
+        // 거의 평행한 두 변의 외적은 축으로 쓰지 않음 (면 축이 이미 같은 방향을 검사)
+        const float PARALLEL_EDGE_EPSILON = 1e-10f;
+
+    } // namespace
 
     // TestOBBCollision: 분리 축 정리(SAT)를 사용하여 두 OBB의 충돌 여부를 검사합니다.
+    // 꼭짓점 투영 대신 OBB::intersects의 닫힌 식 15축 검사를 사용합니다.
     bool SAT::TestOBBCollision(const OBB& obbA, const OBB& obbB) {
-        std::vector<Vector3> axes;
-        // 각 OBB의 로컬 축(회전 행렬의 열 벡터)을 구합니다.
-        const auto& axesA = obbA.getAxes();
-        const auto& axesB = obbB.getAxes();
-
-        // 두 OBB의 축들을 축 목록에 추가합니다.
-        axes.insert(axes.end(), axesA.begin(), axesA.end());
-        axes.insert(axes.end(), axesB.begin(), axesB.end());
-
-        // 두 OBB의 축들의 외적에 의해 생성되는 분리 축들을 추가 (0 벡터는 건너뜁니다.)
-        for (const auto& a : axesA) {
-            for (const auto& b : axesB) {
-                Vector3 crossAxis = a.cross(b);
-                if (crossAxis.magnitudeSquared() < 1e-6f) continue;
-                axes.push_back(crossAxis.normalized());
+        return obbA.intersects(obbB);
+    }
+
+    // TestOBBBatch: 한 OBB를 여러 OBB와 검사 (기준 OBB의 축은 한 번만 읽음)
+    size_t SAT::TestOBBBatch(const OBB& obb, const OBB* others, size_t count, uint32_t* out) {
+        return obb.intersectsBatch(others, count, out);
+    }
+
+    const ConvexHull& HullSAT::unitBox() {
+        static const ConvexHull box = [] {
+            std::vector<Vector3> vertices = {
+                Vector3(-1, -1, -1), Vector3(1, -1, -1), Vector3(1, 1, -1), Vector3(-1, 1, -1),
+                Vector3(-1, -1, 1), Vector3(1, -1, 1), Vector3(1, 1, 1), Vector3(-1, 1, 1)
+            };
+            std::vector<int> indices = {
+                0, 2, 1, 0, 3, 2,   // -z
+                4, 5, 6, 4, 6, 7,   // +z
+                0, 1, 5, 0, 5, 4,   // -y
+                3, 7, 6, 3, 6, 2,   // +y
+                0, 4, 7, 0, 7, 3,   // -x
+                1, 2, 6, 1, 6, 5    // +x
+            };
+            ConvexHull hull(vertices, indices);
+            hull.buildAdjacency();
+            hull.buildFeatures();
+            return hull;
+        }();
+        return box;
+    }
+
+    // 단위 상자를 OBB로 옮기는 변환 (납작한 OBB도 면 법선을 구할 수 있도록 반 크기 하한을 둠)
+    Transform HullSAT::boxTransform(const OBB& box) {
+        const float minExtent = 1e-4f;
+        float extents[3] = {
+            std::max(box.halfExtents.x, minExtent),
+            std::max(box.halfExtents.y, minExtent),
+            std::max(box.halfExtents.z, minExtent)
+        };
+        Matrix3x3 basis = box.orientation;
+        for (int row = 0; row < 3; ++row) {
+            for (int col = 0; col < 3; ++col) {
+                basis(row, col) *= extents[col];
+            }
+        }
+        return Transform(basis, box.center);
+    }
+
+    // 정점은 변환을 그대로 적용하고, 법선은 Transform::normalMatrix로 옮겨 비균등 스케일에도 면에 수직
+    void HullSAT::toWorld(const ConvexHull& shape, const Transform& transform, WorldHull& world) {
+        Matrix3x3 normalMatrix = transform.normalMatrix();
+
+        world.vertices.resize(shape.vertices.size());
+        Vector3 sum(0, 0, 0);
+        for (size_t i = 0; i < shape.vertices.size(); ++i) {
+            world.vertices[i] = transform.transformPoint(shape.vertices[i]);
+            sum += world.vertices[i];
+        }
+        world.centroid = shape.vertices.empty() ? transform.position
+                                                : sum / static_cast<float>(shape.vertices.size());
+
+        world.normals.resize(shape.faces.size());
+        world.offsets.resize(shape.faces.size());
+        for (size_t f = 0; f < shape.faces.size(); ++f) {
+            Vector3 normal = (normalMatrix * shape.faces[f].normal).normalized();
+            world.normals[f] = normal;
+            world.offsets[f] = normal.dot(world.vertices[shape.faceVertices[shape.faces[f].firstVertex]]);
+        }
+    }
+
+    float HullSAT::faceSeparation(const WorldHull& faces, int face, const WorldHull& other) {
+        const Vector3& normal = faces.normals[face];
+        float minDot = std::numeric_limits<float>::max();
+        for (const Vector3& v : other.vertices) {
+            float d = normal.dot(v);
+            if (d < minDot) {
+                minDot = d;
+            }
+        }
+        return minDot - faces.offsets[face];
+    }
+
+    float HullSAT::queryFaces(const WorldHull& faces, const WorldHull& other, int& bestFace) {
+        bestFace = -1;
+        float best = -std::numeric_limits<float>::max();
+        for (size_t f = 0; f < faces.normals.size(); ++f) {
+            float separation = faceSeparation(faces, static_cast<int>(f), other);
+            if (separation > best) {
+                best = separation;
+                bestFace = static_cast<int>(f);
+                if (best > 0.0f) {
+                    break;      // 분리 축을 찾으면 더 볼 필요 없음
+                }
+            }
+        }
+        return best;
+    }
+
+    // 변 a의 두 면 법선 (a, b)와 변 b의 음의 면 법선 (c, d)가 만드는 두 대원 호가 교차하는지
+    bool HullSAT::isMinkowskiFace(const Vector3& a, const Vector3& b, const Vector3& c, const Vector3& d) {
+        Vector3 bxa = b.cross(a);
+        Vector3 dxc = d.cross(c);
+        float cba = c.dot(bxa);
+        float dba = d.dot(bxa);
+        float adc = a.dot(dxc);
+        float bdc = b.dot(dxc);
+
+        // c, d가 평면 bxa의 양쪽, a, b가 평면 dxc의 양쪽, 그리고 같은 반구
+        return cba * dba < 0.0f && adc * bdc < 0.0f && cba * bdc > 0.0f;
+    }
+
+    float HullSAT::edgeSeparation(const ConvexHull& shapeA, int edgeA, const ConvexHull& shapeB, int edgeB,
+                                  Vector3& axis) const {
+        const HullEdge& ea = shapeA.edges[edgeA];
+        const HullEdge& eb = shapeB.edges[edgeB];
+        const Vector3& pA = worldA.vertices[ea.v0];
+        const Vector3& pB = worldB.vertices[eb.v0];
+        Vector3 dirA = worldA.vertices[ea.v1] - pA;
+        Vector3 dirB = worldB.vertices[eb.v1] - pB;
+
+        axis = dirA.cross(dirB);
+        float lengthSq = axis.magnitudeSquared();
+        if (lengthSq < PARALLEL_EDGE_EPSILON * dirA.magnitudeSquared() * dirB.magnitudeSquared()) {
+            return -std::numeric_limits<float>::max();
+        }
+        axis = axis / std::sqrt(lengthSq);
+
+        // A 바깥을 향하도록
+        if (axis.dot(pA - worldA.centroid) < 0.0f) {
+            axis = -axis;
+        }
+        return axis.dot(pB - pA);
+    }
+
+    float HullSAT::queryEdges(const ConvexHull& shapeA, const ConvexHull& shapeB, int& bestA, int& bestB,
+                              Vector3& bestAxis) const {
+        bestA = -1;
+        bestB = -1;
+        float best = -std::numeric_limits<float>::max();
+        for (size_t i = 0; i < shapeA.edges.size(); ++i) {
+            const Vector3& a = worldA.normals[shapeA.edges[i].face0];
+            const Vector3& b = worldA.normals[shapeA.edges[i].face1];
+            for (size_t j = 0; j < shapeB.edges.size(); ++j) {
+                // Minkowski 차에서 B 쪽 법선은 뒤집힘
+                const Vector3 c = -worldB.normals[shapeB.edges[j].face0];
+                const Vector3 d = -worldB.normals[shapeB.edges[j].face1];
+                if (!isMinkowskiFace(a, b, c, d)) {
+                    continue;
+                }
+
+                Vector3 axis;
+                float separation = edgeSeparation(shapeA, static_cast<int>(i), shapeB, static_cast<int>(j), axis);
+                if (separation > best) {
+                    best = separation;
+                    bestA = static_cast<int>(i);
+                    bestB = static_cast<int>(j);
+                    bestAxis = axis;
+                    if (best > 0.0f) {
+                        return best;
+                    }
+                }
             }
         }
+        return best;
+    }
 
-        // 각 축에 대해 두 OBB의 투영 구간이 겹치는지 검사
-        for (const auto& axis : axes) {
-            if (!OverlapOnAxis(obbA, obbB, axis)) {
-                // 어느 한 축이라도 분리 축이 존재하면 충돌하지 않습니다.
-                return false;
+    bool HullSAT::Intersect(
+        const ConvexHull& shapeA,
+        const Transform& transformA,
+        const ConvexHull& shapeB,
+        const Transform& transformB,
+        SATResult& result,
+        SATCache* cache
+    ) {
+        result = SATResult();
+        if (!shapeA.hasFeatures() || !shapeB.hasFeatures()) {
+            return false;
+        }
+
+        toWorld(shapeA, transformA, worldA);
+        toWorld(shapeB, transformB, worldB);
+
+        auto finish = [&](SATFeature feature, int indexA, int indexB, const Vector3& normal, float separation) {
+            result.feature = feature;
+            result.indexA = indexA;
+            result.indexB = indexB;
+            result.normal = normal;
+            result.separation = separation;
+            if (cache) {
+                cache->feature = feature;
+                cache->indexA = indexA;
+                cache->indexB = indexB;
             }
+            return separation <= 0.0f;
+        };
+
+        // 지난 프레임의 분리 축이 여전히 분리하면 나머지 축은 검사하지 않음
+        if (cache) {
+            int faceCountA = static_cast<int>(shapeA.faces.size());
+            int faceCountB = static_cast<int>(shapeB.faces.size());
+            switch (cache->feature) {
+                case SATFeature::FACE_A:
+                    if (cache->indexA >= 0 && cache->indexA < faceCountA) {
+                        float separation = faceSeparation(worldA, cache->indexA, worldB);
+                        if (separation > 0.0f) {
+                            return finish(SATFeature::FACE_A, cache->indexA, -1, worldA.normals[cache->indexA], separation);
+                        }
+                    }
+                    break;
+                case SATFeature::FACE_B:
+                    if (cache->indexB >= 0 && cache->indexB < faceCountB) {
+                        float separation = faceSeparation(worldB, cache->indexB, worldA);
+                        if (separation > 0.0f) {
+                            return finish(SATFeature::FACE_B, -1, cache->indexB, -worldB.normals[cache->indexB], separation);
+                        }
+                    }
+                    break;
+                case SATFeature::EDGES:
+                    if (cache->indexA >= 0 && cache->indexA < static_cast<int>(shapeA.edges.size()) &&
+                        cache->indexB >= 0 && cache->indexB < static_cast<int>(shapeB.edges.size())) {
+                        Vector3 axis;
+                        float separation = edgeSeparation(shapeA, cache->indexA, shapeB, cache->indexB, axis);
+                        if (separation > 0.0f) {
+                            return finish(SATFeature::EDGES, cache->indexA, cache->indexB, axis, separation);
+                        }
+                    }
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        int faceA;
+        float separationA = queryFaces(worldA, worldB, faceA);
+        if (separationA > 0.0f) {
+            return finish(SATFeature::FACE_A, faceA, -1, worldA.normals[faceA], separationA);
         }
 
-        // 모든 축에서 투영 구간이 겹치면 두 OBB는 충돌합니다.
-        return true;
+        int faceB;
+        float separationB = queryFaces(worldB, worldA, faceB);
+        if (separationB > 0.0f) {
+            return finish(SATFeature::FACE_B, -1, faceB, -worldB.normals[faceB], separationB);
+        }
+
+        int edgeA, edgeB;
+        Vector3 edgeAxis;
+        float separationE = queryEdges(shapeA, shapeB, edgeA, edgeB, edgeAxis);
+        if (separationE > 0.0f) {
+            return finish(SATFeature::EDGES, edgeA, edgeB, edgeAxis, separationE);
+        }
+
+        // 모든 축에서 겹침: 침투가 가장 얕은 축 (면 축 우선)
+        bool useFaceB = separationB > RELATIVE_TOLERANCE * separationA + ABSOLUTE_TOLERANCE;
+        float faceSeparationMax = useFaceB ? separationB : separationA;
+        if (edgeA >= 0 && separationE > RELATIVE_TOLERANCE * faceSeparationMax + ABSOLUTE_TOLERANCE) {
+            return finish(SATFeature::EDGES, edgeA, edgeB, edgeAxis, separationE);
+        }
+        if (useFaceB) {
+            return finish(SATFeature::FACE_B, -1, faceB, -worldB.normals[faceB], separationB);
+        }
+        return finish(SATFeature::FACE_A, faceA, -1, worldA.normals[faceA], separationA);
     }
 
-} // namespace Collision
\ No newline at end of file
+} // namespace Collision
@@ -0,0 +1,436 @@
+#include "ShapeCollider.h"
+#include <array>
+#include <cmath>
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+namespace Collision {
+
+    namespace {
+
+        // 두 중심(또는 선분 최근접점)이 이보다 가까우면 방향을 정할 수 없어 +y 법선 사용
+        const float CENTER_EPSILON = 1e-6f;
+
+        // 두 캡슐 선분이 이 코사인 이상 평행하면 겹치는 구간 양 끝에서 두 점
+        const float PARALLEL_COS = 0.999f;
+
+        // 평행한 캡슐의 겹치는 구간이 이보다 짧으면 한 점
+        const float MIN_OVERLAP = 1e-4f;
+
+        // 상자 변 쌍의 외적 길이가 이보다 짧으면 평행한 변으로 보고 축에서 제외
+        const float EDGE_PARALLEL_LENGTH = 1e-5f;
+
+        // 상자-상자에서 면 축을 변 축보다 우선하는 허용값 (HullSAT과 같은 값)
+        const float SAT_RELATIVE_TOLERANCE = 0.98f;
+        const float SAT_ABSOLUTE_TOLERANCE = 1e-3f;
+
+        // 검사 함수가 받는 두 도형과 상자-상자 면 자르기 버퍼
+        struct PairContext {
+            const WorldShape& shapeA;
+            const Transform& transformA;
+            const WorldShape& shapeB;
+            const Transform& transformB;
+            ManifoldBuilder& manifoldBuilder;
+            ContactManifold& manifold;
+            float& depth;
+        };
+
+        using PairTest = bool (*)(const PairContext&);
+
+        // 선분 [start, end]에서 point에 가장 가까운 점
+        Vector3 closestOnSegment(const Vector3& point, const Vector3& start, const Vector3& end) {
+            Vector3 segment = end - start;
+            float lengthSq = segment.magnitudeSquared();
+            if (lengthSq < 1e-12f) {
+                return start;
+            }
+            float t = std::min(std::max((point - start).dot(segment) / lengthSq, 0.0f), 1.0f);
+            return start + segment * t;
+        }
+
+        // 중심 centerA/B, 반지름 radiusA/B인 두 구의 접촉 한 점 (캡슐은 선분 최근접점을 중심으로)
+        bool sphereContact(const PairContext& context, const Vector3& centerA, float radiusA,
+                           const Vector3& centerB, float radiusB) {
+            Vector3 offset = centerB - centerA;
+            float distanceSq = offset.magnitudeSquared();
+            float radiusSum = radiusA + radiusB;
+            if (distanceSq > radiusSum * radiusSum) {
+                return false;
+            }
+
+            float distance = std::sqrt(distanceSq);
+            Vector3 normal = distance > CENTER_EPSILON ? offset / distance : Vector3(0, 1, 0);
+            context.depth = radiusSum - distance;
+            ManifoldBuilder::SinglePoint(context.transformA, context.transformB, normal,
+                                         centerA + normal * radiusA, centerB - normal * radiusB,
+                                         context.depth, context.manifold);
+            return true;
+        }
+
+        bool sphereSphere(const PairContext& context) {
+            return sphereContact(context, context.shapeA.center, context.shapeA.radius,
+                                 context.shapeB.center, context.shapeB.radius);
+        }
+
+        bool sphereCapsule(const PairContext& context) {
+            const WorldShape& capsule = context.shapeB;
+            Vector3 closest = closestOnSegment(context.shapeA.center, capsule.segmentStart(), capsule.segmentEnd());
+            return sphereContact(context, context.shapeA.center, context.shapeA.radius, closest, capsule.radius);
+        }
+
+        bool capsuleCapsule(const PairContext& context) {
+            const WorldShape& a = context.shapeA;
+            const WorldShape& b = context.shapeB;
+            Vector3 closestA, closestB;
+            ManifoldBuilder::ClosestSegmentPoints(a.segmentStart(), a.segmentEnd(), b.segmentStart(), b.segmentEnd(), closestA, closestB);
+            if (!sphereContact(context, closestA, a.radius, closestB, b.radius)) {
+                return false;
+            }
+
+            // 거의 평행하면 B 선분을 A 축에 투영해 겹치는 구간 양 끝에서 한 점씩 (누운 캡슐이 굴러가지 않도록)
+            if (std::abs(a.axis.dot(b.axis)) < PARALLEL_COS) {
+                return true;
+            }
+            float startB = (b.segmentStart() - a.center).dot(a.axis);
+            float endB = (b.segmentEnd() - a.center).dot(a.axis);
+            float low = std::max(-a.halfHeight, std::min(startB, endB));
+            float high = std::min(a.halfHeight, std::max(startB, endB));
+            if (high - low < MIN_OVERLAP) {
+                return true;
+            }
+
+            const Vector3 normal = context.manifold.normal;
+            ContactManifold pair;
+            pair.normal = normal;
+            pair.feature = SATFeature::NONE;
+            const float ends[2] = { low, high };
+            for (int i = 0; i < 2; ++i) {
+                Vector3 onA = a.center + a.axis * ends[i];
+                Vector3 onB = closestOnSegment(onA, b.segmentStart(), b.segmentEnd());
+                float depth = a.radius + b.radius - (onB - onA).dot(normal);
+                if (depth < 0.0f) {
+                    return true;
+                }
+                ManifoldBuilder::AddPoint(context.transformA, context.transformB,
+                                          onA + normal * a.radius, onB - normal * b.radius, depth, i, pair);
+            }
+            context.manifold = pair;
+            return true;
+        }
+
+        bool sphereBox(const PairContext& context) {
+            const Vector3& center = context.shapeA.center;
+            float radius = context.shapeA.radius;
+            const OBB& box = context.shapeB.box;
+
+            // 상자 좌표계에서 구 중심을 상자 안으로 잘라 최근접점을 찾음
+            Vector3 local = box.orientation.transpose() * (center - box.center);
+            const float half[3] = { box.halfExtents.x, box.halfExtents.y, box.halfExtents.z };
+            float coords[3] = { local.x, local.y, local.z };
+            bool inside = true;
+            for (int i = 0; i < 3; ++i) {
+                if (coords[i] < -half[i]) {
+                    coords[i] = -half[i];
+                    inside = false;
+                } else if (coords[i] > half[i]) {
+                    coords[i] = half[i];
+                    inside = false;
+                }
+            }
+
+            if (!inside) {
+                Vector3 closest = box.center + box.orientation * Vector3(coords[0], coords[1], coords[2]);
+                Vector3 offset = closest - center;
+                float distanceSq = offset.magnitudeSquared();
+                if (distanceSq > radius * radius) {
+                    return false;
+                }
+                float distance = std::sqrt(distanceSq);
+                Vector3 normal = distance > CENTER_EPSILON ? offset / distance : (box.center - center).normalized();
+                context.depth = radius - distance;
+                ManifoldBuilder::SinglePoint(context.transformA, context.transformB, normal,
+                                             center + normal * radius, closest, context.depth, context.manifold);
+                return true;
+            }
+
+            // 중심이 상자 안: 가장 가까운 면으로 밀어냄 (B는 그 면의 반대 방향으로 움직여야 분리)
+            int axis = 0;
+            float faceDistance = half[0] - std::abs(coords[0]);
+            for (int i = 1; i < 3; ++i) {
+                float distance = half[i] - std::abs(coords[i]);
+                if (distance < faceDistance) {
+                    faceDistance = distance;
+                    axis = i;
+                }
+            }
+            Vector3 faceNormal = box.getAxis(axis) * (coords[axis] < 0.0f ? -1.0f : 1.0f);
+            Vector3 normal = -faceNormal;
+            context.depth = radius + faceDistance;
+            ManifoldBuilder::SinglePoint(context.transformA, context.transformB, normal,
+                                         center + normal * radius, center + faceNormal * faceDistance,
+                                         context.depth, context.manifold);
+            return true;
+        }
+
+        // 단위 상자 껍질(HullSAT::unitBox)에서 로컬 축 axis의 +/- 방향 면 인덱스
+        int boxFace(int axis, bool positive) {
+            static const std::array<int, 6> faces = [] {
+                std::array<int, 6> table = {{ -1, -1, -1, -1, -1, -1 }};
+                const ConvexHull& box = HullSAT::unitBox();
+                for (size_t f = 0; f < box.faces.size(); ++f) {
+                    const Vector3& normal = box.faces[f].normal;
+                    const float components[3] = { normal.x, normal.y, normal.z };
+                    for (int k = 0; k < 3; ++k) {
+                        if (std::abs(components[k]) > 0.5f) {
+                            table[k * 2 + (components[k] > 0.0f ? 1 : 0)] = static_cast<int>(f);
+                        }
+                    }
+                }
+                return table;
+            }();
+            return faces[axis * 2 + (positive ? 1 : 0)];
+        }
+
+        // 상자-상자 분리 축 검사: 면 축 6개와 변 쌍 축 9개의 분리 거리를 닫힌 식으로 계산하고 분리 축을 찾으면 바로 종료
+        // 겹치면 침투가 가장 얕은 축(HullSAT과 같은 허용값으로 면 축 우선)을 골라
+        // 면 축은 단위 상자 껍질 면 자르기로, 변 축은 두 변의 최근접점 한 점으로 접촉점을 만든다.
+        // 접촉점 로컬 좌표는 상자 껍질 변환(HullSAT::boxTransform) 기준
+        bool boxBox(const PairContext& context) {
+            const OBB& a = context.shapeA.box;
+            const OBB& b = context.shapeB.box;
+            const Vector3 axesA[3] = { a.getAxis(0), a.getAxis(1), a.getAxis(2) };
+            const Vector3 axesB[3] = { b.getAxis(0), b.getAxis(1), b.getAxis(2) };
+            const float extentsA[3] = { a.halfExtents.x, a.halfExtents.y, a.halfExtents.z };
+            const float extentsB[3] = { b.halfExtents.x, b.halfExtents.y, b.halfExtents.z };
+            Vector3 offset = b.center - a.center;
+
+            // 거의 평행한 변 쌍의 외적이 0에 가까워도 면 축 검사가 안전하도록 |R|에 작은 값을 더함 (Gottschalk)
+            float absR[3][3];
+            for (int i = 0; i < 3; ++i) {
+                for (int j = 0; j < 3; ++j) {
+                    absR[i][j] = std::abs(axesA[i].dot(axesB[j])) + 1e-6f;
+                }
+            }
+
+            float separationA = -std::numeric_limits<float>::max();
+            int axisA = 0;
+            for (int i = 0; i < 3; ++i) {
+                float radiusB = extentsB[0] * absR[i][0] + extentsB[1] * absR[i][1] + extentsB[2] * absR[i][2];
+                float separation = std::abs(offset.dot(axesA[i])) - extentsA[i] - radiusB;
+                if (separation > 0.0f) {
+                    return false;
+                }
+                if (separation > separationA) {
+                    separationA = separation;
+                    axisA = i;
+                }
+            }
+
+            float separationB = -std::numeric_limits<float>::max();
+            int axisB = 0;
+            for (int j = 0; j < 3; ++j) {
+                float radiusA = extentsA[0] * absR[0][j] + extentsA[1] * absR[1][j] + extentsA[2] * absR[2][j];
+                float separation = std::abs(offset.dot(axesB[j])) - radiusA - extentsB[j];
+                if (separation > 0.0f) {
+                    return false;
+                }
+                if (separation > separationB) {
+                    separationB = separation;
+                    axisB = j;
+                }
+            }
+
+            float separationE = -std::numeric_limits<float>::max();
+            int edgeA = -1, edgeB = -1;
+            Vector3 edgeAxis;
+            for (int i = 0; i < 3; ++i) {
+                for (int j = 0; j < 3; ++j) {
+                    Vector3 axis = axesA[i].cross(axesB[j]);
+                    float length = axis.magnitude();
+                    if (length < EDGE_PARALLEL_LENGTH) {
+                        continue;
+                    }
+                    axis /= length;
+                    float radiusA = 0.0f, radiusB = 0.0f;
+                    for (int k = 0; k < 3; ++k) {
+                        radiusA += extentsA[k] * std::abs(axesA[k].dot(axis));
+                        radiusB += extentsB[k] * std::abs(axesB[k].dot(axis));
+                    }
+                    float distance = offset.dot(axis);
+                    float separation = std::abs(distance) - radiusA - radiusB;
+                    if (separation > 0.0f) {
+                        return false;
+                    }
+                    if (separation > separationE) {
+                        separationE = separation;
+                        edgeA = i;
+                        edgeB = j;
+                        edgeAxis = distance < 0.0f ? -axis : axis;
+                    }
+                }
+            }
+
+            const ConvexHull& box = HullSAT::unitBox();
+            Transform transformA = HullSAT::boxTransform(a);
+            Transform transformB = HullSAT::boxTransform(b);
+
+            bool useFaceB = separationB > SAT_RELATIVE_TOLERANCE * separationA + SAT_ABSOLUTE_TOLERANCE;
+            float faceSeparation = useFaceB ? separationB : separationA;
+            if (edgeA >= 0 && separationE > SAT_RELATIVE_TOLERANCE * faceSeparation + SAT_ABSOLUTE_TOLERANCE) {
+                // 각 상자에서 법선 방향(B는 반대 방향)으로 가장 먼 변
+                Vector3 centerA = a.center;
+                Vector3 centerB = b.center;
+                for (int k = 0; k < 3; ++k) {
+                    if (k != edgeA) {
+                        centerA += axesA[k] * (axesA[k].dot(edgeAxis) > 0.0f ? extentsA[k] : -extentsA[k]);
+                    }
+                    if (k != edgeB) {
+                        centerB += axesB[k] * (axesB[k].dot(edgeAxis) < 0.0f ? extentsB[k] : -extentsB[k]);
+                    }
+                }
+                Vector3 halfA = axesA[edgeA] * extentsA[edgeA];
+                Vector3 halfB = axesB[edgeB] * extentsB[edgeB];
+                Vector3 closestA, closestB;
+                ManifoldBuilder::ClosestSegmentPoints(centerA - halfA, centerA + halfA, centerB - halfB, centerB + halfB, closestA, closestB);
+                context.depth = -separationE;
+                ManifoldBuilder::SinglePoint(transformA, transformB, edgeAxis, closestA, closestB, context.depth,
+                                             context.manifold);
+                context.manifold.feature = SATFeature::EDGES;
+                context.manifold.points[0].featureId = ContactManifold::makeEdgeFeatureId(edgeA, edgeB);
+                return true;
+            }
+
+            // 면 축: 상대 쪽을 향한 면을 기준 면으로 자르기
+            SATResult result;
+            if (useFaceB) {
+                float side = offset.dot(axesB[axisB]) < 0.0f ? -1.0f : 1.0f;
+                result.feature = SATFeature::FACE_B;
+                result.indexB = boxFace(axisB, side < 0.0f);
+                result.normal = axesB[axisB] * side;
+                result.separation = separationB;
+            } else {
+                float side = offset.dot(axesA[axisA]) < 0.0f ? -1.0f : 1.0f;
+                result.feature = SATFeature::FACE_A;
+                result.indexA = boxFace(axisA, side > 0.0f);
+                result.normal = axesA[axisA] * side;
+                result.separation = separationA;
+            }
+
+            // 자른 점의 깊이는 기준 면 안쪽 점만 재므로 SAT 깊이보다 얕을 수 있어 깊이는 SAT 값을 사용
+            context.depth = -result.separation;
+            if (!context.manifoldBuilder.FromSAT(box, transformA, box, transformB, result, context.manifold)) {
+                Vector3 deepestB = box.support(-result.normal, transformB);
+                ManifoldBuilder::SinglePoint(transformA, transformB, result.normal,
+                                             deepestB + result.normal * context.depth, deepestB, context.depth,
+                                             context.manifold);
+            }
+            return true;
+        }
+
+        // 쌍별 닫힌 식 (정해진 순서 하나만 정의, 반대 순서는 selectTest가 A/B를 바꿔 사용)
+        template <ShapeType A, ShapeType B>
+        struct ClosedForm {
+            static constexpr PairTest test = nullptr;
+        };
+
+        template <>
+        struct ClosedForm<ShapeType::SPHERE, ShapeType::SPHERE> {
+            static constexpr PairTest test = &sphereSphere;
+        };
+
+        template <>
+        struct ClosedForm<ShapeType::SPHERE, ShapeType::CAPSULE> {
+            static constexpr PairTest test = &sphereCapsule;
+        };
+
+        template <>
+        struct ClosedForm<ShapeType::CAPSULE, ShapeType::CAPSULE> {
+            static constexpr PairTest test = &capsuleCapsule;
+        };
+
+        template <>
+        struct ClosedForm<ShapeType::SPHERE, ShapeType::BOX> {
+            static constexpr PairTest test = &sphereBox;
+        };
+
+        template <>
+        struct ClosedForm<ShapeType::BOX, ShapeType::BOX> {
+            static constexpr PairTest test = &boxBox;
+        };
+
+        // B-A 순서의 검사로 A-B 쌍을 검사하고 다양체를 A 기준으로 되돌림
+        template <ShapeType A, ShapeType B>
+        bool swappedTest(const PairContext& context) {
+            PairContext swapped = { context.shapeB, context.transformB, context.shapeA, context.transformA,
+                                    context.manifoldBuilder, context.manifold, context.depth };
+            if (!ClosedForm<B, A>::test(swapped)) {
+                return false;
+            }
+
+            ContactManifold& manifold = context.manifold;
+            manifold.normal = -manifold.normal;
+            if (manifold.feature == SATFeature::FACE_A) {
+                manifold.feature = SATFeature::FACE_B;
+            } else if (manifold.feature == SATFeature::FACE_B) {
+                manifold.feature = SATFeature::FACE_A;
+            }
+            std::swap(manifold.hullA, manifold.hullB);
+            for (int i = 0; i < manifold.pointCount; ++i) {
+                std::swap(manifold.points[i].localA, manifold.points[i].localB);
+            }
+            return true;
+        }
+
+        template <ShapeType A, ShapeType B>
+        constexpr PairTest selectTest() {
+            if constexpr (ClosedForm<A, B>::test != nullptr) {
+                return ClosedForm<A, B>::test;
+            } else if constexpr (ClosedForm<B, A>::test != nullptr) {
+                return &swappedTest<A, B>;
+            } else {
+                return nullptr;
+            }
+        }
+
+        constexpr size_t SHAPE_COUNT = static_cast<size_t>(ShapeType::COUNT);
+
+        // 표[A * SHAPE_COUNT + B] = A-B 쌍 검사 함수 (없으면 nullptr)
+        template <size_t... I>
+        constexpr std::array<PairTest, sizeof...(I)> makeTestTable(std::index_sequence<I...>) {
+            return {{ selectTest<static_cast<ShapeType>(I / SHAPE_COUNT), static_cast<ShapeType>(I % SHAPE_COUNT)>()... }};
+        }
+
+        constexpr std::array<PairTest, SHAPE_COUNT * SHAPE_COUNT> PAIR_TESTS =
+            makeTestTable(std::make_index_sequence<SHAPE_COUNT * SHAPE_COUNT>());
+
+        PairTest findTest(ShapeType typeA, ShapeType typeB) {
+            size_t a = static_cast<size_t>(typeA);
+            size_t b = static_cast<size_t>(typeB);
+            if (a >= SHAPE_COUNT || b >= SHAPE_COUNT) {
+                return nullptr;
+            }
+            return PAIR_TESTS[a * SHAPE_COUNT + b];
+        }
+
+    } // namespace
+
+    bool ShapeCollider::HasClosedForm(ShapeType typeA, ShapeType typeB) {
+        return findTest(typeA, typeB) != nullptr;
+    }
+
+    bool ShapeCollider::Collide(const WorldShape& shapeA, const Transform& transformA,
+                                const WorldShape& shapeB, const Transform& transformB,
+                                ContactManifold& manifold, float& depth) {
+        PairTest test = findTest(shapeA.type, shapeB.type);
+        if (test == nullptr) {
+            return false;
+        }
+
+        manifold.clear();
+        depth = 0.0f;
+        PairContext context = { shapeA, transformA, shapeB, transformB, manifoldBuilder, manifold, depth };
+        return test(context);
+    }
+
+} // namespace Collision
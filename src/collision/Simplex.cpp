@@ -0,0 +1,259 @@
+#include "Simplex.h"
+
+namespace Collision {
+
+    namespace {
+
+        inline float dot3(const Vector3& a, const Vector3& b) {
+            return a.x * b.x + a.y * b.y + a.z * b.z;
+        }
+
+        inline void sub3(const Vector3& a, const Vector3& b, Vector3& out) {
+            out.x = a.x - b.x;
+            out.y = a.y - b.y;
+            out.z = a.z - b.z;
+        }
+
+        // 사면체 전체의 최근접점이 가장 먼 꼭짓점 거리 대비 이 비율(제곱)보다 멀면 감싼 것으로 보지 않음
+        const float FULL_TOLERANCE = 1e-8f;
+
+    } // namespace
+
+    void Simplex::add(const SimplexVertex& vertex) {
+        // 비어 있는 가장 낮은 슬롯
+        last = 0;
+        lastBit = 1;
+        while (bits & lastBit) {
+            ++last;
+            lastBit <<= 1;
+        }
+
+        vertices[last] = vertex;
+        allBits = bits | lastBit;
+
+        // 새 꼭짓점과 기존 활성 꼭짓점 사이의 변 벡터만 갱신
+        for (int i = 0; i < MAX_VERTICES; ++i) {
+            if (bits & (1u << i)) {
+                sub3(vertices[i].w, vertex.w, edges[i][last]);
+                sub3(vertex.w, vertices[i].w, edges[last][i]);
+            }
+        }
+
+        computeDeterminants();
+    }
+
+    // Johnson 행렬식 점화식: X에 j를 더한 집합에서
+    // det[X ∪ {j}][j] = Σ_{i ∈ X} det[X][i] * ((w_k - w_j) · w_i)  (k는 X의 아무 원소)
+    // 새 꼭짓점이 포함되지 않은 부분 집합의 값은 이전 반복에서 계산한 것을 그대로 쓴다.
+    void Simplex::computeDeterminants() {
+        det[lastBit][last] = 1.0f;
+
+        for (int i = 0; i < MAX_VERTICES; ++i) {
+            uint32_t bitI = 1u << i;
+            if (!(bits & bitI)) {
+                continue;
+            }
+
+            uint32_t s2 = bitI | lastBit;
+            det[s2][i] = dot3(edges[last][i], vertices[last].w);
+            det[s2][last] = dot3(edges[i][last], vertices[i].w);
+
+            for (int j = 0; j < i; ++j) {
+                uint32_t bitJ = 1u << j;
+                if (!(bits & bitJ)) {
+                    continue;
+                }
+
+                uint32_t s3 = bitJ | s2;
+                det[s3][j] = det[s2][i] * dot3(edges[i][j], vertices[i].w) +
+                             det[s2][last] * dot3(edges[i][j], vertices[last].w);
+                det[s3][i] = det[bitJ | lastBit][j] * dot3(edges[j][i], vertices[j].w) +
+                             det[bitJ | lastBit][last] * dot3(edges[j][i], vertices[last].w);
+                det[s3][last] = det[bitJ | bitI][j] * dot3(edges[j][last], vertices[j].w) +
+                                det[bitJ | bitI][i] * dot3(edges[j][last], vertices[i].w);
+            }
+        }
+
+        if (allBits == 0xF) {
+            det[0xF][0] = det[0xE][1] * dot3(edges[1][0], vertices[1].w) +
+                          det[0xE][2] * dot3(edges[1][0], vertices[2].w) +
+                          det[0xE][3] * dot3(edges[1][0], vertices[3].w);
+            det[0xF][1] = det[0xD][0] * dot3(edges[0][1], vertices[0].w) +
+                          det[0xD][2] * dot3(edges[0][1], vertices[2].w) +
+                          det[0xD][3] * dot3(edges[0][1], vertices[3].w);
+            det[0xF][2] = det[0xB][0] * dot3(edges[0][2], vertices[0].w) +
+                          det[0xB][1] * dot3(edges[0][2], vertices[1].w) +
+                          det[0xB][3] * dot3(edges[0][2], vertices[3].w);
+            det[0xF][3] = det[0x7][0] * dot3(edges[0][3], vertices[0].w) +
+                          det[0x7][1] * dot3(edges[0][3], vertices[1].w) +
+                          det[0x7][2] * dot3(edges[0][3], vertices[2].w);
+        }
+    }
+
+    // subset의 꼭짓점 계수가 모두 양수이고, 빠진 꼭짓점을 더하면 계수가 양수가 되지 않는 경우
+    // (원점의 투영이 subset의 볼록 껍질 내부이고 그 Voronoi 영역 안에 있음)
+    bool Simplex::isValid(uint32_t subset) const {
+        for (int i = 0; i < MAX_VERTICES; ++i) {
+            uint32_t bit = 1u << i;
+            if (!(allBits & bit)) {
+                continue;
+            }
+            if (subset & bit) {
+                if (det[subset][i] <= 0.0f) {
+                    return false;
+                }
+            } else if (det[subset | bit][i] > 0.0f) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void Simplex::computeVector(uint32_t subset, Vector3& v) const {
+        float sum = 0.0f;
+        float x = 0.0f, y = 0.0f, z = 0.0f;
+        for (int i = 0; i < MAX_VERTICES; ++i) {
+            if (subset & (1u << i)) {
+                float d = det[subset][i];
+                sum += d;
+                x += vertices[i].w.x * d;
+                y += vertices[i].w.y * d;
+                z += vertices[i].w.z * d;
+            }
+        }
+        float inv = 1.0f / sum;
+        v.x = x * inv;
+        v.y = y * inv;
+        v.z = z * inv;
+    }
+
+    bool Simplex::closest(Vector3& v) {
+        // 가장 가까운 부분 단순체는 반드시 새 꼭짓점을 포함하므로 그런 부분 집합만 검사
+        for (uint32_t s = bits; s != 0; --s) {
+            if ((s & bits) == s && isValid(s | lastBit)) {
+                bits = s | lastBit;
+                computeVector(bits, v);
+                return true;
+            }
+        }
+
+        if (isValid(lastBit)) {
+            bits = lastBit;
+            v = vertices[last].w;
+            return true;
+        }
+
+        return false;
+    }
+
+    bool Simplex::closestAny(Vector3& v) {
+        for (uint32_t s = allBits; s != 0; --s) {
+            if ((s & allBits) == s && isValid(s)) {
+                Vector3 candidate;
+                computeVector(s, candidate);
+                // 납작한 사면체는 행렬식이 잡음뿐이라 계수가 모두 양수여도 원점을 감싸지 않을 수 있음
+                if (s == 0xF && dot3(candidate, candidate) > FULL_TOLERANCE * maxLengthSquared(s)) {
+                    continue;
+                }
+                bits = s;
+                v = candidate;
+                return true;
+            }
+        }
+
+        // 수치 오차로 조건을 만족하는 부분 집합이 없으면 무게 중심 좌표가 모두 양수인
+        // 부분 집합 중 원점에 가장 가까운 것을 고름 (van den Bergen의 backup 절차)
+        // 납작한 사면체 전체는 원점을 감쌌다고 볼 수 없으므로 제외
+        uint32_t best = 0;
+        float bestSq = 0.0f;
+        for (uint32_t s = allBits; s != 0; --s) {
+            if ((s & allBits) != s || s == 0xF) {
+                continue;
+            }
+            bool positive = true;
+            for (int i = 0; i < MAX_VERTICES && positive; ++i) {
+                if ((s & (1u << i)) && det[s][i] <= 0.0f) {
+                    positive = false;
+                }
+            }
+            if (!positive) {
+                continue;
+            }
+            Vector3 candidate;
+            computeVector(s, candidate);
+            float lengthSq = dot3(candidate, candidate);
+            if (best == 0 || lengthSq < bestSq) {
+                best = s;
+                bestSq = lengthSq;
+                v = candidate;
+            }
+        }
+        if (best == 0) {
+            return false;
+        }
+        bits = best;
+        return true;
+    }
+
+    bool Simplex::contains(const Vector3& w) const {
+        for (int i = 0; i < MAX_VERTICES; ++i) {
+            if ((allBits & (1u << i)) && vertices[i].w == w) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool Simplex::containsActive(const Vector3& w) const {
+        for (int i = 0; i < MAX_VERTICES; ++i) {
+            if ((bits & (1u << i)) && vertices[i].w == w) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    float Simplex::maxLengthSquared() const {
+        return maxLengthSquared(bits);
+    }
+
+    float Simplex::maxLengthSquared(uint32_t subset) const {
+        float maxSq = 0.0f;
+        for (int i = 0; i < MAX_VERTICES; ++i) {
+            if (subset & (1u << i)) {
+                float lengthSq = dot3(vertices[i].w, vertices[i].w);
+                if (lengthSq > maxSq) {
+                    maxSq = lengthSq;
+                }
+            }
+        }
+        return maxSq;
+    }
+
+    void Simplex::computePoints(Vector3& pointA, Vector3& pointB) const {
+        float sum = 0.0f;
+        pointA = Vector3::zero();
+        pointB = Vector3::zero();
+        for (int i = 0; i < MAX_VERTICES; ++i) {
+            if (bits & (1u << i)) {
+                float d = det[bits][i];
+                sum += d;
+                pointA += vertices[i].a * d;
+                pointB += vertices[i].b * d;
+            }
+        }
+        if (sum > 0.0f) {
+            pointA /= sum;
+            pointB /= sum;
+        }
+    }
+
+    int Simplex::size() const {
+        int count = 0;
+        for (uint32_t b = bits; b != 0; b &= b - 1) {
+            ++count;
+        }
+        return count;
+    }
+
+} // namespace Collision
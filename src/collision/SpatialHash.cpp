@@ -0,0 +1,173 @@
+#include "SpatialHash.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Collision {
+
+    SpatialHashGrid::SpatialHashGrid(float cellSize)
+        : cellSize(1.0f), invCellSize(1.0f), stamp(0) {
+        setCellSize(cellSize);
+    }
+
+    void SpatialHashGrid::setCellSize(float size) {
+        cellSize = std::max(size, 1e-4f);
+        invCellSize = 1.0f / cellSize;
+    }
+
+    void SpatialHashGrid::clear() {
+        proxies.clear();
+        entries.clear();
+        usedSlots.clear();
+        oversized.clear();
+    }
+
+    int SpatialHashGrid::toCell(float value) const {
+        return static_cast<int>(std::floor(value * invCellSize));
+    }
+
+    // 셀 삽입 수의 두 배 이상이 되도록 테이블 크기 조정 (커질 때만 할당)
+    void SpatialHashGrid::ensureCapacity(size_t cellInsertions) {
+        size_t required = std::max<size_t>(cellInsertions * 2, 64);
+        if (slots.size() >= required) {
+            return;
+        }
+
+        size_t capacity = 64;
+        while (capacity < required) {
+            capacity <<= 1;
+        }
+
+        Slot empty = { 0, 0, 0, 0, NONE };
+        slots.assign(capacity, empty);
+        stamp = 1;
+    }
+
+    // 셀 (x, y, z)에 프록시 항목 추가 (선형 탐사)
+    void SpatialHashGrid::insert(int x, int y, int z, uint32_t proxy) {
+        uint32_t mask = static_cast<uint32_t>(slots.size() - 1);
+        uint32_t index = hashCell(x, y, z) & mask;
+
+        while (slots[index].stamp == stamp) {
+            const Slot& slot = slots[index];
+            if (slot.x == x && slot.y == y && slot.z == z) {
+                break;
+            }
+            index = (index + 1) & mask;
+        }
+
+        Slot& slot = slots[index];
+        if (slot.stamp != stamp) {
+            slot.x = x;
+            slot.y = y;
+            slot.z = z;
+            slot.stamp = stamp;
+            slot.head = NONE;
+            usedSlots.push_back(index);
+        }
+
+        Entry entry = { proxy, slot.head };
+        slot.head = static_cast<uint32_t>(entries.size());
+        entries.push_back(entry);
+    }
+
+    void SpatialHashGrid::findCollisionPairs(const AABBSoA& bounds, std::vector<std::pair<int, int>>& collisionPairs) {
+        // 프레임 번호를 올려 이전 프레임의 슬롯을 한 번에 무효화
+        if (++stamp == 0) {
+            for (Slot& slot : slots) {
+                slot.stamp = 0;
+            }
+            stamp = 1;
+        }
+        entries.clear();
+        usedSlots.clear();
+        oversized.clear();
+
+        // 1. 객체별 셀 범위 계산
+        size_t cellInsertions = 0;
+        proxies.resize(bounds.size());
+        for (uint32_t i = 0; i < proxies.size(); ++i) {
+            Proxy& proxy = proxies[i];
+
+            proxy.minCell[0] = toCell(bounds.minX[i]);
+            proxy.minCell[1] = toCell(bounds.minY[i]);
+            proxy.minCell[2] = toCell(bounds.minZ[i]);
+            proxy.maxCell[0] = toCell(bounds.maxX[i]);
+            proxy.maxCell[1] = toCell(bounds.maxY[i]);
+            proxy.maxCell[2] = toCell(bounds.maxZ[i]);
+
+            long long cells = 1;
+            for (int axis = 0; axis < 3; ++axis) {
+                cells *= static_cast<long long>(proxy.maxCell[axis]) - proxy.minCell[axis] + 1;
+            }
+
+            proxy.oversized = cells > MAX_CELLS_PER_OBJECT;
+            if (proxy.oversized) {
+                oversized.push_back(i);
+            } else {
+                cellInsertions += static_cast<size_t>(cells);
+            }
+        }
+
+        // 2. 겹치는 모든 셀에 객체 삽입
+        ensureCapacity(cellInsertions);
+        for (uint32_t i = 0; i < proxies.size(); ++i) {
+            const Proxy& proxy = proxies[i];
+            if (proxy.oversized) {
+                continue;
+            }
+            for (int x = proxy.minCell[0]; x <= proxy.maxCell[0]; ++x) {
+                for (int y = proxy.minCell[1]; y <= proxy.maxCell[1]; ++y) {
+                    for (int z = proxy.minCell[2]; z <= proxy.maxCell[2]; ++z) {
+                        insert(x, y, z, i);
+                    }
+                }
+            }
+        }
+
+        // 3. 셀마다 쌍 검사
+        // 같은 쌍이 여러 셀에서 발견되므로 두 AABB의 교집합이 시작되는 셀에서만 쌍을 보고
+        for (uint32_t slotIndex : usedSlots) {
+            const Slot& slot = slots[slotIndex];
+
+            cellScratch.clear();
+            for (uint32_t e = slot.head; e != NONE; e = entries[e].next) {
+                cellScratch.push_back(entries[e].proxy);
+            }
+
+            for (size_t a = 0; a < cellScratch.size(); ++a) {
+                uint32_t ia = cellScratch[a];
+                const Proxy& pa = proxies[ia];
+                for (size_t b = a + 1; b < cellScratch.size(); ++b) {
+                    uint32_t ib = cellScratch[b];
+                    const Proxy& pb = proxies[ib];
+
+                    if (std::max(pa.minCell[0], pb.minCell[0]) != slot.x ||
+                        std::max(pa.minCell[1], pb.minCell[1]) != slot.y ||
+                        std::max(pa.minCell[2], pb.minCell[2]) != slot.z) {
+                        continue;
+                    }
+
+                    if (bounds.overlaps(ia, ib)) {
+                        collisionPairs.emplace_back(static_cast<int>(ia), static_cast<int>(ib));
+                    }
+                }
+            }
+        }
+
+        // 4. 큰 객체는 다른 모든 객체와 SIMD로 일괄 검사
+        if (!oversized.empty()) {
+            hitScratch.resize(proxies.size());
+        }
+        for (uint32_t o : oversized) {
+            size_t hitCount = bounds.overlapBatch(bounds.get(o), 0, proxies.size(), hitScratch.data());
+            for (size_t h = 0; h < hitCount; ++h) {
+                uint32_t j = hitScratch[h];
+                if (j == o || (proxies[j].oversized && j < o)) {
+                    continue;
+                }
+                collisionPairs.emplace_back(static_cast<int>(o), static_cast<int>(j));
+            }
+        }
+    }
+
+} // namespace Collision
@@ -0,0 +1,235 @@
+#include "StaticBVH.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace Collision {
+
+namespace {
+
+    // SAH 비용 계수 (노드 순회 1회 대비 기본체 검사 1회 비용)
+    const float TRAVERSAL_COST = 1.0f;
+    const float INTERSECTION_COST = 1.0f;
+
+    // 축 번호로 벡터 성분 읽기
+    inline float axisValue(const Vector3& v, int axis) {
+        return axis == 0 ? v.x : (axis == 1 ? v.y : v.z);
+    }
+
+    // 분할 구간 하나의 누적 정보
+    struct Bin {
+        AABB bounds;
+        int count;
+
+        Bin() : count(0) {}
+    };
+
+} // namespace
+
+void StaticBVH::setBounds(StaticBVHNode& node, const AABB& aabb) {
+    node.minX = aabb.min.x; node.minY = aabb.min.y; node.minZ = aabb.min.z;
+    node.maxX = aabb.max.x; node.maxY = aabb.max.y; node.maxZ = aabb.max.z;
+}
+
+AABB StaticBVH::transformBounds(const AABB& box, const Transform& transform, const Matrix3x3& absBasis) {
+    Vector3 center = transform.transformPoint(box.getCenter());
+    Vector3 half = (box.max - box.min) * 0.5f;
+    const auto& m = absBasis.m;
+    Vector3 extent(m[0][0] * half.x + m[0][1] * half.y + m[0][2] * half.z,
+                   m[1][0] * half.x + m[1][1] * half.y + m[1][2] * half.z,
+                   m[2][0] * half.x + m[2][1] * half.y + m[2][2] * half.z);
+    return AABB(center - extent, center + extent);
+}
+
+Matrix3x3 StaticBVH::absoluteBasis(const Matrix3x3& basis) {
+    Matrix3x3 result;
+    for (int r = 0; r < 3; ++r) {
+        for (int c = 0; c < 3; ++c) {
+            result.m[r][c] = std::abs(basis.m[r][c]);
+        }
+    }
+    return result;
+}
+
+void StaticBVH::clear() {
+    nodes.clear();
+    primitiveIndices.clear();
+    primitiveBounds.clear();
+    leafBounds.clear();
+    centroids.clear();
+}
+
+// 기본체 AABB 목록으로 트리 구축
+void StaticBVH::build(const std::vector<AABB>& bounds, int leafSize) {
+    clear();
+    if (bounds.empty()) {
+        return;
+    }
+
+    maxLeafSize = std::max(1, leafSize);
+
+    primitiveBounds = bounds;
+    primitiveIndices.resize(bounds.size());
+    centroids.resize(bounds.size());
+    for (size_t i = 0; i < bounds.size(); ++i) {
+        primitiveIndices[i] = static_cast<int>(i);
+        centroids[i] = bounds[i].getCenter();
+    }
+
+    // 이진 트리의 노드 수는 최대 2n - 1
+    nodes.reserve(bounds.size() * 2 - 1);
+    buildNode(0, static_cast<int>(bounds.size()), 0);
+
+    centroids.clear();
+    centroids.shrink_to_fit();
+
+    // 리프 검사는 SoA 배열에서 SIMD로 수행
+    leafBounds.resize(primitiveBounds.size());
+    for (size_t i = 0; i < primitiveBounds.size(); ++i) {
+        leafBounds.set(i, primitiveBounds[i]);
+    }
+}
+
+// [begin, end) 구간의 기본체로 노드를 만들고 깊이 우선으로 자식 구축
+void StaticBVH::buildNode(int begin, int end, int depth) {
+    int nodeIndex = static_cast<int>(nodes.size());
+    nodes.push_back(StaticBVHNode());
+
+    AABB nodeBounds;
+    AABB centroidBounds;
+    for (int i = begin; i < end; ++i) {
+        nodeBounds = nodeBounds.merge(primitiveBounds[i]);
+        centroidBounds = centroidBounds.merge(AABB(centroids[i], centroids[i]));
+    }
+    setBounds(nodes[nodeIndex], nodeBounds);
+
+    int count = end - begin;
+    auto makeLeaf = [&]() {
+        nodes[nodeIndex].offset = static_cast<uint32_t>(begin);
+        nodes[nodeIndex].count = static_cast<uint32_t>(count);
+    };
+
+    if (count <= maxLeafSize || depth >= MAX_DEPTH) {
+        makeLeaf();
+        return;
+    }
+
+    // 축마다 중심점을 BIN_COUNT개 구간에 나누고 구간 경계마다 SAH 비용 계산
+    float bestCost = std::numeric_limits<float>::max();
+    int bestAxis = -1;
+    int bestSplit = 0;
+    float parentArea = nodeBounds.getSurfaceArea();
+
+    for (int axis = 0; axis < 3; ++axis) {
+        float cmin = axisValue(centroidBounds.min, axis);
+        float cmax = axisValue(centroidBounds.max, axis);
+        if (cmax - cmin <= 1e-12f) {
+            continue;
+        }
+        float scale = BIN_COUNT / (cmax - cmin);
+
+        Bin bins[BIN_COUNT];
+        for (int i = begin; i < end; ++i) {
+            int b = std::min(BIN_COUNT - 1, static_cast<int>((axisValue(centroids[i], axis) - cmin) * scale));
+            bins[b].count++;
+            bins[b].bounds = bins[b].bounds.merge(primitiveBounds[i]);
+        }
+
+        // 왼쪽에서 누적한 면적/개수와 오른쪽에서 누적한 면적/개수
+        float leftArea[BIN_COUNT - 1], rightArea[BIN_COUNT - 1];
+        int leftCount[BIN_COUNT - 1], rightCount[BIN_COUNT - 1];
+        AABB leftBox, rightBox;
+        int leftSum = 0, rightSum = 0;
+        for (int i = 0; i < BIN_COUNT - 1; ++i) {
+            leftSum += bins[i].count;
+            leftCount[i] = leftSum;
+            leftBox = leftBox.merge(bins[i].bounds);
+            leftArea[i] = leftSum > 0 ? leftBox.getSurfaceArea() : 0.0f;
+
+            int j = BIN_COUNT - 1 - i;
+            rightSum += bins[j].count;
+            rightCount[j - 1] = rightSum;
+            rightBox = rightBox.merge(bins[j].bounds);
+            rightArea[j - 1] = rightSum > 0 ? rightBox.getSurfaceArea() : 0.0f;
+        }
+
+        for (int i = 0; i < BIN_COUNT - 1; ++i) {
+            if (leftCount[i] == 0 || rightCount[i] == 0) {
+                continue;
+            }
+            float cost = leftArea[i] * leftCount[i] + rightArea[i] * rightCount[i];
+            if (cost < bestCost) {
+                bestCost = cost;
+                bestAxis = axis;
+                bestSplit = i;
+            }
+        }
+    }
+
+    int mid;
+    if (bestAxis < 0) {
+        // 중심점이 모두 같은 경우: 개수 기준으로 반으로 나눔
+        mid = begin + count / 2;
+    } else {
+        float splitCost = TRAVERSAL_COST + INTERSECTION_COST * bestCost / parentArea;
+        float leafCost = INTERSECTION_COST * count;
+        if (splitCost >= leafCost) {
+            makeLeaf();
+            return;
+        }
+
+        float cmin = axisValue(centroidBounds.min, bestAxis);
+        float scale = BIN_COUNT / (axisValue(centroidBounds.max, bestAxis) - cmin);
+
+        // 선택한 구간 경계를 기준으로 기본체 배열을 제자리 분할
+        int i = begin;
+        int j = end - 1;
+        while (i <= j) {
+            int b = std::min(BIN_COUNT - 1, static_cast<int>((axisValue(centroids[i], bestAxis) - cmin) * scale));
+            if (b <= bestSplit) {
+                ++i;
+            } else {
+                std::swap(primitiveIndices[i], primitiveIndices[j]);
+                std::swap(primitiveBounds[i], primitiveBounds[j]);
+                std::swap(centroids[i], centroids[j]);
+                --j;
+            }
+        }
+        mid = i;
+
+        if (mid == begin || mid == end) {
+            mid = begin + count / 2;
+        }
+    }
+
+    // 왼쪽 자식은 nodeIndex + 1에 위치, 오른쪽 자식 인덱스만 기록
+    buildNode(begin, mid, depth + 1);
+    nodes[nodeIndex].offset = static_cast<uint32_t>(nodes.size());
+    nodes[nodeIndex].count = 0;
+    buildNode(mid, end, depth + 1);
+}
+
+// 트리의 SAH 비용: 내부 노드 순회 비용 + 리프 기본체 검사 비용 (루트 면적 기준)
+float StaticBVH::computeCost() const {
+    if (nodes.empty()) {
+        return 0.0f;
+    }
+
+    float rootArea = nodes[0].getAABB().getSurfaceArea();
+    if (rootArea <= 0.0f) {
+        return 0.0f;
+    }
+
+    float cost = 0.0f;
+    for (const StaticBVHNode& node : nodes) {
+        float area = node.getAABB().getSurfaceArea() / rootArea;
+        cost += node.isLeaf() ? area * INTERSECTION_COST * node.count : area * TRAVERSAL_COST;
+    }
+    return cost;
+}
+
+void StaticBVH::query(const AABB& aabb, std::vector<int>& results) const {
+    query(aabb, [&results](int primitive) { results.push_back(primitive); });
+}
+
+} // namespace Collision
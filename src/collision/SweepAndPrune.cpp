@@ -0,0 +1,168 @@
+#include "SweepAndPrune.h"
+#include <algorithm>
+
+namespace Collision {
+
+    // 객체를 추가하고 끝점을 목록 끝에 붙임 (다음 update()의 삽입 정렬에서 제자리로 이동)
+    void SweepAndPrune::addObject(Object3D* object) {
+        if (object == nullptr || objectToProxy.count(object)) {
+            return;
+        }
+
+        uint32_t id;
+        if (!freeProxies.empty()) {
+            id = freeProxies.back();
+            freeProxies.pop_back();
+        } else {
+            id = static_cast<uint32_t>(proxies.size());
+            proxies.push_back(Proxy());
+        }
+
+        Proxy& proxy = proxies[id];
+        proxy.object = object;
+        refreshProxy(proxy);
+        objectToProxy[object] = id;
+
+        for (int axis = 0; axis < 3; ++axis) {
+            Endpoint minPoint = { proxy.min[axis], id << 1 };
+            Endpoint maxPoint = { proxy.max[axis], (id << 1) | 1u };
+            endpoints[axis].push_back(minPoint);
+            endpoints[axis].push_back(maxPoint);
+        }
+    }
+
+    // 객체의 끝점과 관련 쌍을 모두 제거
+    void SweepAndPrune::removeObject(Object3D* object) {
+        auto it = objectToProxy.find(object);
+        if (it == objectToProxy.end()) {
+            return;
+        }
+        uint32_t id = it->second;
+        objectToProxy.erase(it);
+
+        for (int axis = 0; axis < 3; ++axis) {
+            std::vector<Endpoint>& list = endpoints[axis];
+            list.erase(std::remove_if(list.begin(), list.end(),
+                [id](const Endpoint& e) { return e.proxy() == id; }), list.end());
+        }
+
+        for (size_t i = 0; i < pairs.size();) {
+            if (pairs[i].first == id || pairs[i].second == id) {
+                removePair(pairs[i].first, pairs[i].second);
+            } else {
+                ++i;
+            }
+        }
+
+        proxies[id].object = nullptr;
+        freeProxies.push_back(id);
+    }
+
+    // 모든 상태 초기화
+    void SweepAndPrune::clear() {
+        for (int axis = 0; axis < 3; ++axis) {
+            endpoints[axis].clear();
+        }
+        proxies.clear();
+        freeProxies.clear();
+        objectToProxy.clear();
+        pairs.clear();
+        pairIndex.clear();
+    }
+
+    // 객체의 현재 월드 AABB를 프록시에 복사
+    void SweepAndPrune::refreshProxy(Proxy& proxy) {
+        const AABB& aabb = proxy.object->getAABB();
+        proxy.min[0] = aabb.min.x; proxy.min[1] = aabb.min.y; proxy.min[2] = aabb.min.z;
+        proxy.max[0] = aabb.max.x; proxy.max[1] = aabb.max.y; proxy.max[2] = aabb.max.z;
+    }
+
+    // 끝점 값 갱신 후 축별 삽입 정렬
+    void SweepAndPrune::update() {
+        for (Proxy& proxy : proxies) {
+            if (proxy.object != nullptr) {
+                refreshProxy(proxy);
+            }
+        }
+
+        for (int axis = 0; axis < 3; ++axis) {
+            for (Endpoint& e : endpoints[axis]) {
+                const Proxy& proxy = proxies[e.proxy()];
+                e.value = e.isMax() ? proxy.max[axis] : proxy.min[axis];
+            }
+            sortAxis(axis);
+        }
+    }
+
+    // 삽입 정렬: 끝점이 다른 객체의 끝점을 넘어갈 때마다 쌍 상태를 갱신
+    // - 최소점이 다른 객체의 최대점 앞으로 이동: 이 축에서 겹치기 시작 (나머지 축도 겹치면 쌍 추가)
+    // - 최대점이 다른 객체의 최소점 앞으로 이동: 이 축에서 분리됨 (쌍 제거)
+    void SweepAndPrune::sortAxis(int axis) {
+        std::vector<Endpoint>& list = endpoints[axis];
+
+        for (size_t i = 1; i < list.size(); ++i) {
+            Endpoint key = list[i];
+            size_t j = i;
+
+            while (j > 0 && less(key, list[j - 1])) {
+                const Endpoint& prev = list[j - 1];
+
+                if (key.isMax() != prev.isMax() && key.proxy() != prev.proxy()) {
+                    if (!key.isMax()) {
+                        if (overlaps(key.proxy(), prev.proxy())) {
+                            addPair(key.proxy(), prev.proxy());
+                        }
+                    } else {
+                        removePair(key.proxy(), prev.proxy());
+                    }
+                }
+
+                list[j] = prev;
+                --j;
+            }
+            list[j] = key;
+        }
+    }
+
+    // 세 축 모두에서 두 프록시가 겹치는지 확인
+    bool SweepAndPrune::overlaps(uint32_t a, uint32_t b) const {
+        const Proxy& pa = proxies[a];
+        const Proxy& pb = proxies[b];
+        return (pa.min[0] <= pb.max[0] && pa.max[0] >= pb.min[0]) &&
+               (pa.min[1] <= pb.max[1] && pa.max[1] >= pb.min[1]) &&
+               (pa.min[2] <= pb.max[2] && pa.max[2] >= pb.min[2]);
+    }
+
+    void SweepAndPrune::addPair(uint32_t a, uint32_t b) {
+        uint64_t key = pairKey(a, b);
+        if (pairIndex.count(key)) {
+            return;
+        }
+        pairIndex[key] = static_cast<uint32_t>(pairs.size());
+        pairs.emplace_back(std::min(a, b), std::max(a, b));
+    }
+
+    void SweepAndPrune::removePair(uint32_t a, uint32_t b) {
+        auto it = pairIndex.find(pairKey(a, b));
+        if (it == pairIndex.end()) {
+            return;
+        }
+        uint32_t index = it->second;
+        pairIndex.erase(it);
+
+        // 마지막 쌍을 빈 자리로 옮김
+        if (index + 1 != pairs.size()) {
+            pairs[index] = pairs.back();
+            pairIndex[pairKey(pairs[index].first, pairs[index].second)] = index;
+        }
+        pairs.pop_back();
+    }
+
+    void SweepAndPrune::getPairs(std::vector<std::pair<Object3D*, Object3D*>>& outPairs) const {
+        outPairs.reserve(outPairs.size() + pairs.size());
+        for (const auto& pair : pairs) {
+            outPairs.emplace_back(proxies[pair.first].object, proxies[pair.second].object);
+        }
+    }
+
+} // namespace Collision
@@ -3,47 +3,305 @@
 #include <limits>
 #include <iostream>
 
+namespace {
+
+    // 연속 충돌 검사 기본 프레임 시간 (60Hz)
+    const float DEFAULT_TIME_STEP = 1.0f / 60.0f;
+
+    // 검사 구간 동안의 상대 이동이 두 객체 중 얇은 쪽 반 크기의 이 배수를 넘으면 빠른 쌍
+    const float CCD_MOTION_RATIO = 1.0f;
+
+    // 보수적 전진을 멈추는 거리와 최대 반복 횟수
+    const float CCD_TOLERANCE = 1e-3f;
+    const int CCD_MAX_ITERATIONS = 32;
+
+    // 볼록 분해 껍질 목록으로 검사하는 객체인지 (기본 도형을 지정한 객체는 도형 다면체 하나로 검사)
+    bool usesHullList(const Object3D* object) {
+        return object->isDecomposed() && object->getShapeType() == ShapeType::HULL;
+    }
+
+    // GJK 경로에서 쓰는 객체의 볼록체 목록 (분해된 객체는 껍질 목록, 아니면 단일 볼록체)
+    void collisionHulls(const Object3D* object, const ConvexHull*& hulls, size_t& count) {
+        if (usesHullList(object)) {
+            hulls = object->getConvexHulls().data();
+            count = object->getConvexHulls().size();
+        } else {
+            hulls = &object->getCollisionHull();
+            count = 1;
+        }
+    }
+
+    // 메시 삼각형과 광선의 가장 가까운 교차 (Moller-Trumbore, 양면), 법선은 광선을 마주 보는 쪽
+    bool raycastTriangles(const std::vector<Vector3>& vertices, const std::vector<int>& indices,
+                          const Vector3& origin, const Vector3& direction, float maxDistance,
+                          float& t, Vector3& normal) {
+        bool found = false;
+        int vertexCount = static_cast<int>(vertices.size());
+        for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+            int i0 = indices[i], i1 = indices[i + 1], i2 = indices[i + 2];
+            if (i0 < 0 || i1 < 0 || i2 < 0 || i0 >= vertexCount || i1 >= vertexCount || i2 >= vertexCount) {
+                continue;
+            }
+            Vector3 edge1 = vertices[i1] - vertices[i0];
+            Vector3 edge2 = vertices[i2] - vertices[i0];
+            Vector3 p = direction.cross(edge2);
+            float det = edge1.dot(p);
+            if (std::abs(det) < 1e-12f) {
+                continue;   // 광선이 삼각형 평면과 평행
+            }
+            float invDet = 1.0f / det;
+            Vector3 s = origin - vertices[i0];
+            float u = s.dot(p) * invDet;
+            if (u < 0.0f || u > 1.0f) {
+                continue;
+            }
+            Vector3 q = s.cross(edge1);
+            float v = direction.dot(q) * invDet;
+            if (v < 0.0f || u + v > 1.0f) {
+                continue;
+            }
+            float tHit = edge2.dot(q) * invDet;
+            if (tHit < 0.0f || tHit > maxDistance) {
+                continue;
+            }
+            maxDistance = tHit;
+            t = tHit;
+            normal = edge1.cross(edge2);
+            if (normal.dot(direction) > 0.0f) {
+                normal = -normal;
+            }
+            found = true;
+        }
+        return found;
+    }
+
+    // 상자의 여덟 꼭짓점을 변환해 감싸는 AABB
+    AABB transformBounds(const AABB& box, const Transform& transform) {
+        AABB result;
+        for (int i = 0; i < 8; ++i) {
+            Vector3 corner((i & 1) ? box.max.x : box.min.x,
+                           (i & 2) ? box.max.y : box.min.y,
+                           (i & 4) ? box.max.z : box.min.z);
+            Vector3 point = transform.transformPoint(corner);
+            result = result.merge(AABB(point, point));
+        }
+        return result;
+    }
+
+    // 볼록체 정점을 변환해 감싸는 AABB
+    AABB hullBounds(const ConvexHull& hull, const Transform& transform) {
+        AABB result;
+        for (const Vector3& vertex : hull.vertices) {
+            Vector3 point = transform.transformPoint(vertex);
+            result = result.merge(AABB(point, point));
+        }
+        return result;
+    }
+
+    // AABB를 모든 방향으로 margin만큼 넓힘
+    AABB inflateBounds(const AABB& box, float margin) {
+        Vector3 extent(margin, margin, margin);
+        return AABB(box.min - extent, box.max + extent);
+    }
+
+    // 로컬 AABB의 가장 짧은 반 크기 (스케일 포함)
+    float thinnestHalfExtent(const Object3D* object) {
+        Vector3 half = (object->getLocalAABB().max - object->getLocalAABB().min) * 0.5f;
+        const Vector3& scale = object->getScale();
+        return std::min({ half.x * std::abs(scale.x), half.y * std::abs(scale.y), half.z * std::abs(scale.z) });
+    }
+
+} // namespace
+
 // 생성자 
 CollisionManager::CollisionManager()
-    : broadPhaseAlgorithm(CollisionAlgorithm::AABB),
+    : nextObjectId(0),
+      broadPhaseAlgorithm(CollisionAlgorithm::AABB),
       narrowPhaseAlgorithm(CollisionAlgorithm::GJK),
       frameCount(0),
-      collisionCheckInterval(1) {
+      collisionCheckInterval(1),
+      staticTreeDirty(false),
+      sleepThreshold(60),
+      islandsValid(false),
+      continuousDetection(false),
+      timeStep(DEFAULT_TIME_STEP),
+      rayTreeDirty(true),
+      narrowPhaseLogging(false) {
+}
+
+// 소멸자, 등록된 객체들이 더 이상 이 관리자를 참조하지 않도록 함
+CollisionManager::~CollisionManager() {
+    for (auto* obj : objects) {
+        obj->manager = nullptr;
+    }
+    for (auto* obj : staticObjects) {
+        obj->manager = nullptr;
+    }
 }
 
 // 충돌 감지를 수행할 3D 객체를 관리 목록에 추가
+// 정적 객체는 정적 BVH에, 키네마틱/동적 객체는 대략적 충돌 감지 구조에 등록
 void CollisionManager::addObject(Object3D* object) {
-    if (object && std::find(objects.begin(), objects.end(), object) == objects.end()) {
+    if (object == nullptr ||
+        std::find(objects.begin(), objects.end(), object) != objects.end() ||
+        std::find(staticObjects.begin(), staticObjects.end(), object) != staticObjects.end()) {
+        return;
+    }
+
+    object->collisionId = nextObjectId++;
+    object->manager = this;
+    object->sleeping = false;
+    object->idleFrames = 0;
+    islandsValid = false;
+    rayTreeDirty = true;
+
+    if (object->bodyType == BodyType::STATIC) {
+        staticObjects.push_back(object);
+        staticTreeDirty = true;
+    } else {
         objects.push_back(object);
+        addToBroadPhase(object);
+    }
+}
+
+// 정적 객체 추가 (강체 종류를 STATIC으로 바꾼 뒤 등록)
+void CollisionManager::addStaticObject(Object3D* object) {
+    if (object == nullptr) {
+        return;
     }
+    object->setBodyType(BodyType::STATIC);
+    addObject(object);
+}
+
+// 정적 객체가 움직였거나 로컬 AABB가 바뀌면 다음 검사 때 정적 BVH 재구축
+void CollisionManager::markStaticDirty() {
+    staticTreeDirty = true;
+    rayTreeDirty = true;
+}
+
+void CollisionManager::markRaycastDirty() {
+    rayTreeDirty = true;
 }
 
 // 특정 객체를 관리 목록에서 제거, 관련 충돌 상태도 제거
 void CollisionManager::removeObject(Object3D* object) {
     auto it = std::find(objects.begin(), objects.end(), object);
-    if (it != objects.end()) {
-        objects.erase(it);
+    auto staticIt = std::find(staticObjects.begin(), staticObjects.end(), object);
+    if (it != objects.end() || staticIt != staticObjects.end()) {
+        if (it != objects.end()) {
+            objects.erase(it);
+            removeFromBroadPhase(object);
+        } else {
+            staticObjects.erase(staticIt);
+            staticTreeDirty = true;
+        }
         
-        // 객체와 관련된 충돌 상태 제거
-        for (auto it = collisionState.begin(); it != collisionState.end();) {
-            if (it->first.first == object || it->first.second == object) {
-                it = collisionState.erase(it);
-            } else {
-                ++it;
+        // 객체와 관련된 충돌 쌍 제거 (충돌 중이던 상대에게는 종료 알림)
+        pairManager.removeObject(object->collisionId, [](const Collision::CollisionPair& pair) {
+            if (pair.colliding) {
+                pair.objectA->removeCollision(pair.objectB);
+                pair.objectB->removeCollision(pair.objectA);
             }
-        }
+        });
+        object->collisionId = Object3D::INVALID_ID;
+        object->manager = nullptr;
+        object->sleeping = false;
+        islandsValid = false;
+        rayTreeDirty = true;
     }
 }
 
 // 모든 객체와 충돌 상태를 초기화
 void CollisionManager::clearObjects() {
+    for (auto* obj : objects) {
+        obj->manager = nullptr;
+    }
+    for (auto* obj : staticObjects) {
+        obj->manager = nullptr;
+    }
     objects.clear();
-    collisionState.clear();
+    staticObjects.clear();
+    staticTree.clear();
+    staticTreeDirty = false;
+    pairManager.clear();
+    sweepAndPrune.clear();
+    dynamicTree.clear();
+    spatialHash.clear();
+    linearTree.clear();
+    worldBounds.clear();
+    islandsValid = false;
+    rayTreeDirty = true;
 }
 
 // 대락적 충돌 감지 알고리즘
 void CollisionManager::setBroadPhaseAlgorithm(CollisionAlgorithm algorithm) {
+    if (broadPhaseAlgorithm == algorithm) {
+        return;
+    }
     broadPhaseAlgorithm = algorithm;
+    rebuildBroadPhase();
+}
+
+// 선택된 대략적 충돌 감지 구조를 현재 객체 목록으로 다시 구성
+void CollisionManager::rebuildBroadPhase() {
+    sweepAndPrune.clear();
+    dynamicTree.clear();
+
+    for (auto* obj : objects) {
+        addToBroadPhase(obj);
+    }
+}
+
+// 정적 객체들의 AABB로 SAH BVH 구축
+void CollisionManager::rebuildStaticTree() {
+    std::vector<AABB> bounds;
+    bounds.reserve(staticObjects.size());
+    for (auto* obj : staticObjects) {
+        obj->update();
+        bounds.push_back(obj->getAABB());
+    }
+
+    staticTree.build(bounds);
+    staticTreeDirty = false;
+}
+
+// 움직이는 객체마다 정적 BVH를 질의해 (움직이는 객체, 정적 객체) 쌍 추가
+void CollisionManager::queryStaticTree(std::vector<std::pair<Object3D*, Object3D*>>& potentialCollisions) {
+    if (staticTreeDirty) {
+        rebuildStaticTree();
+    }
+    if (staticTree.empty()) {
+        return;
+    }
+
+    for (size_t i = 0; i < objects.size(); ++i) {
+        Object3D* obj = objects[i];
+        staticTree.query(worldBounds.get(i), [&](int index) {
+            if (canCollide(obj, staticObjects[index])) {
+                potentialCollisions.emplace_back(obj, staticObjects[index]);
+            }
+        });
+    }
+}
+
+// 현재 대략적 충돌 감지 알고리즘이 사용하는 구조에 객체 등록
+void CollisionManager::addToBroadPhase(Object3D* object) {
+    switch (broadPhaseAlgorithm) {
+        case CollisionAlgorithm::SAP:
+            sweepAndPrune.addObject(object);
+            break;
+        case CollisionAlgorithm::BVH:
+            dynamicTree.addObject(object);
+            break;
+        default:
+            break;
+    }
+}
+
+// 모든 대략적 충돌 감지 구조에서 객체 제거 (등록되지 않은 구조에서는 아무 일도 하지 않음)
+void CollisionManager::removeFromBroadPhase(Object3D* object) {
+    sweepAndPrune.removeObject(object);
+    dynamicTree.removeObject(object);
 }
 
 // 정밀 충돌 감지 알고리즘
@@ -51,6 +309,39 @@ void CollisionManager::setNarrowPhaseAlgorithm(CollisionAlgorithm algorithm) {
     narrowPhaseAlgorithm = algorithm;
 }
 
+// 균일 격자 해시의 셀 크기 설정
+void CollisionManager::setSpatialHashCellSize(float cellSize) {
+    spatialHash.setCellSize(cellSize);
+}
+
+// 레이어 검사를 통과한 쌍에 추가로 적용할 사용자 필터 설정 (nullptr이면 해제)
+void CollisionManager::setPairFilter(const PairFilter& filter) {
+    pairFilter = filter;
+}
+
+// 정밀 단계 요약 출력 설정 (켜면 GJK/SAT 검사마다 후보 껍질 쌍 수와 결과를 한 줄 출력)
+void CollisionManager::setNarrowPhaseLogging(bool enabled) {
+    narrowPhaseLogging = enabled;
+}
+
+// 레이어 비트와 사용자 필터로 두 객체를 검사해야 하는지 판단
+bool CollisionManager::canCollide(Object3D* objA, Object3D* objB) const {
+    if (!objA->shouldCollideWith(*objB)) {
+        return false;
+    }
+    return !pairFilter || pairFilter(objA, objB);
+}
+
+// 쌍 목록을 직접 채우는 구조(SAP, 동적 BVH)의 결과에서 걸러진 쌍 제거
+void CollisionManager::filterPairs(std::vector<std::pair<Object3D*, Object3D*>>& potentialCollisions) {
+    potentialCollisions.erase(
+        std::remove_if(potentialCollisions.begin(), potentialCollisions.end(),
+            [this](const std::pair<Object3D*, Object3D*>& pair) {
+                return !canCollide(pair.first, pair.second);
+            }),
+        potentialCollisions.end());
+}
+
 // 충돌 검사를 수행할 프레임 간격 설정
 void CollisionManager::setCollisionCheckInterval(int interval) {
     collisionCheckInterval = std::max(1, interval);
@@ -70,16 +361,37 @@ void CollisionManager::update() {
     
     std::cout << "  객체 목록 크기: " << objects.size() << std::endl;
     
-    // 1. 모든 객체의 AABB 업데이트
+    // 1. 모든 객체의 AABB 업데이트 (스윕 AABB가 바뀔 수 있으므로 광선 질의 구조도 다시 만듦)
+    rayTreeDirty = true;
     std::cout << "  각 객체의 AABB 업데이트 중..." << std::endl;
     for (auto* obj : objects) {
         if (obj == nullptr) {
             std::cout << "    경고: 널 객체 발견!" << std::endl;
             continue;
         }
+        if (obj->sleeping) {
+            // 휴면 중인 객체는 변환이 그대로이므로 갱신하지 않음
+            continue;
+        }
         std::cout << "    객체 '" << obj->getName() << "' 업데이트" << std::endl;
+        
+        // 연속 충돌 검사 중이면 속도가 있는 객체의 AABB를 검사 구간 동안 스윕
+        float sweep = (continuousDetection && obj->hasVelocity()) ? sweepDuration() : 0.0f;
+        if (obj->sweepTime != sweep) {
+            obj->sweepTime = sweep;
+            obj->aabbDirty = true;
+        }
         obj->update();
+        
+        // 움직이지 않은 프레임 수 누적 (휴면 판정용, 속도가 있으면 움직이는 중으로 봄)
+        if (obj->movedSinceCheck || obj->hasVelocity()) {
+            obj->movedSinceCheck = false;
+            obj->idleFrames = 0;
+        } else if (obj->idleFrames < std::numeric_limits<int>::max()) {
+            obj->idleFrames++;
+        }
     }
+    refreshWorldBounds();
     
     // 2. 대략적 충돌 감지 단계 (Broad Phase)
     std::cout << "  대략적 충돌 감지(Broad Phase) 중..." << std::endl;
@@ -87,8 +399,8 @@ void CollisionManager::update() {
     broadPhase(potentialCollisions);
     std::cout << "    잠재적 충돌 쌍: " << potentialCollisions.size() << "개" << std::endl;
     
-    // 현재 충돌 중인 객체 쌍 추적을 위한 맵
-    std::unordered_map<std::pair<Object3D*, Object3D*>, bool, ObjectPairHash> currentCollisions;
+    // 이번 프레임에 보고된 쌍을 표시하기 위해 쌍 테이블의 프레임 번호 증가
+    pairManager.beginFrame();
     
     // 3. 정밀 충돌 감지 단계 (Narrow Phase)
     std::cout << "  정밀 충돌 감지(Narrow Phase) 시작..." << std::endl;
@@ -101,23 +413,48 @@ void CollisionManager::update() {
         std::cout << "    쌍 " << pairCounter << ": '" << objA->getName() 
                   << "' 와 '" << objB->getName() << "'" << std::endl;
         
-        // 정규화된 객체 쌍 (메모리 주소가 작은 객체가 먼저)
-        std::pair<Object3D*, Object3D*> normalizedPair = 
-            (objA < objB) ? std::make_pair(objA, objB) : std::make_pair(objB, objA);
+        // 객체 ID 쌍으로 지속 상태 조회 (처음 보고된 쌍이면 추가)
+        bool isNewPair = false;
+        Collision::CollisionPair& state = pairManager.touch(objA, objA->collisionId, objB, objB->collisionId, isNewPair);
+        std::cout << "      쌍 상태: " << (isNewPair ? "새 쌍" : (state.colliding ? "충돌 유지 중" : "유지 중")) << std::endl;
+        
+        // 움직인 정적 객체와 닿아 있던 휴면 객체는 섬째로 깨움 (밀려 들어오거나 받침이 빠졌을 수 있음)
+        if (objA->bodyType == BodyType::STATIC && objA->movedSinceCheck && objB->sleeping) {
+            wakeObject(objB);
+        } else if (objB->bodyType == BodyType::STATIC && objB->movedSinceCheck && objA->sleeping) {
+            wakeObject(objA);
+        }
+        
+        // 두 객체가 모두 쉬고 있으면 지난 결과를 그대로 사용
+        if (!isNewPair && isResting(objA) && isResting(objB)) {
+            std::cout << "      휴면 쌍: 이전 결과 재사용" << std::endl;
+            continue;
+        }
+        
+        // 쌍 테이블과 같은 순서(작은 ID가 A)로 검사해 쌍별 캐시가 항상 같은 껍질을 가리키도록 함
+        if (objA != state.objectA) {
+            std::swap(objA, objB);
+        }
         
         // 정밀 충돌 감지 수행
         CollisionInfo collisionInfo;
+        Collision::ContactManifold manifold;
         std::cout << "      narrowPhase 실행..." << std::endl;
-        bool isColliding = narrowPhase(objA, objB, collisionInfo);
+        bool isColliding = narrowPhase(objA, objB, collisionInfo, state, manifold);
         std::cout << "      충돌 결과: " << (isColliding ? "충돌함" : "충돌 없음") << std::endl;
         
-        // 충돌 상태 업데이트
-        currentCollisions[normalizedPair] = isColliding;
+        // 접촉 다양체를 쌍에 유지 (지난 프레임 점과 대응), 충돌이 끝났거나 점이 없으면 풀에 반환
+        if (isColliding && manifold.pointCount > 0) {
+            const Collision::ContactManifold& persistent = pairManager.updateManifold(state, manifold);
+            collisionInfo.contactPoint = persistent.center();
+            std::cout << "      접촉점: " << persistent.pointCount << "개" << std::endl;
+        } else {
+            pairManager.releaseManifold(state);
+        }
         
         if (isColliding) {
-            std::cout << "      충돌 정보 객체에 추가" << std::endl;
-            // 충돌 정보 객체에 추가
-            objA->addCollision(collisionInfo);
+            // AABB 정밀 검사처럼 충돌 정보를 채우지 않는 알고리즘도 상대 객체는 알 수 있도록 설정
+            collisionInfo.otherObject = objB;
             
             // 반대 방향 충돌 정보 생성
             CollisionInfo reverseInfo(
@@ -126,78 +463,346 @@ void CollisionManager::update() {
                 -collisionInfo.contactNormal,  // 법선 반대 방향
                 collisionInfo.penetrationDepth
             );
-            objB->addCollision(reverseInfo);
+            reverseInfo.timeOfImpact = collisionInfo.timeOfImpact;
+            
+            if (state.colliding) {
+                // 충돌 유지: 충돌 정보 갱신
+                objA->updateCollision(collisionInfo);
+                objB->updateCollision(reverseInfo);
+            } else {
+                std::cout << "      충돌 정보 객체에 추가" << std::endl;
+                // 충돌 시작: 충돌 정보 객체에 추가
+                objA->addCollision(collisionInfo);
+                objB->addCollision(reverseInfo);
+            }
         }
-        else {
+        else if (state.colliding) {
             // 이전에 충돌 중이었으면 충돌 제거
-            auto prevIt = collisionState.find(normalizedPair);
-            if (prevIt != collisionState.end() && prevIt->second) {
-                std::cout << "      이전 충돌 상태 제거" << std::endl;
-                objA->removeCollision(objB);
-                objB->removeCollision(objA);
-            }
+            std::cout << "      이전 충돌 상태 제거" << std::endl;
+            objA->removeCollision(objB);
+            objB->removeCollision(objA);
         }
+        
+        // 충돌 상태 업데이트
+        state.colliding = isColliding;
     }
     
-    // 이전에 충돌 중이었지만 이번 프레임에서 검사되지 않은 쌍 확인
+    // 이번 프레임에 보고되지 않은 쌍 제거 (충돌 중이었으면 충돌 종료)
     std::cout << "  이전 충돌 상태 정리 중..." << std::endl;
     int cleanupCounter = 0;
-    for (const auto& pair : collisionState) {
-        if (pair.second && currentCollisions.find(pair.first) == currentCollisions.end()) {
-            cleanupCounter++;
-            Object3D* objA = pair.first.first;
-            Object3D* objB = pair.first.second;
-            
-            std::cout << "    이전 충돌 제거 " << cleanupCounter << ": '"
-                      << objA->getName() << "' 와 '" << objB->getName() << "'" << std::endl;
-            
-            // 더 이상 충돌 중이 아니므로 제거
-            objA->removeCollision(objB);
-            objB->removeCollision(objA);
+    pairManager.removeStale([&](const Collision::CollisionPair& pair) {
+        if (!pair.colliding) {
+            return;
+        }
+        cleanupCounter++;
+        std::cout << "    이전 충돌 제거 " << cleanupCounter << ": '"
+                  << pair.objectA->getName() << "' 와 '" << pair.objectB->getName() << "'" << std::endl;
+        
+        // 더 이상 충돌 중이 아니므로 제거 (상대가 떨어져 나간 휴면 객체는 깨움)
+        pair.objectA->removeCollision(pair.objectB);
+        pair.objectB->removeCollision(pair.objectA);
+        if (pair.objectA->sleeping) {
+            wakeObject(pair.objectA);
         }
+        if (pair.objectB->sleeping) {
+            wakeObject(pair.objectB);
+        }
+    });
+    
+    // 정적 객체의 이동은 이번 검사에 반영했으므로 표시 해제
+    for (auto* obj : staticObjects) {
+        obj->movedSinceCheck = false;
     }
     
-    // 충돌 상태 업데이트
-    std::cout << "  충돌 상태 맵 업데이트" << std::endl;
-    collisionState = std::move(currentCollisions);
+    // 충돌 중인 쌍으로 접촉 섬을 만들고 오래 멈춘 섬은 휴면
+    updateIslands();
+    std::cout << "  휴면 객체: " << getSleepingCount() << "개" << std::endl;
+    std::cout << "  GJK 누적 반복: " << gjkSolver.getStats().iterations
+              << "회 (웜 스타트로 절약: " << gjkSolver.getStats().savedIterations << "회)" << std::endl;
     
     std::cout << "CollisionManager::update() - 완료" << std::endl;
 }
 
+// 연속 충돌 검사 켜기/끄기 (스윕 AABB는 다음 update에서 다시 계산)
+void CollisionManager::setContinuousDetection(bool enabled) {
+    continuousDetection = enabled;
+}
+
+bool CollisionManager::isContinuousDetection() const {
+    return continuousDetection;
+}
+
+// 프레임 하나의 시간 설정 (초, 0 이하면 무시)
+void CollisionManager::setTimeStep(float seconds) {
+    if (seconds > 0.0f) {
+        timeStep = seconds;
+    }
+}
+
+// 한 번의 충돌 검사가 담당하는 시간 (검사 간격만큼의 프레임)
+float CollisionManager::sweepDuration() const {
+    return timeStep * collisionCheckInterval;
+}
+
+// 검사 구간 동안의 상대 이동 상한이 얇은 쪽 객체의 반 크기를 넘어 이산 검사로는 지나칠 수 있는 쌍인지
+bool CollisionManager::isFastPair(Object3D* objA, Object3D* objB) const {
+    if (!objA->hasVelocity() && !objB->hasVelocity()) {
+        return false;
+    }
+    float duration = sweepDuration();
+    float motion = (objA->getLinearVelocity() - objB->getLinearVelocity()).magnitude() * duration +
+                   (objA->getAngularVelocity().magnitude() * objA->getBoundingRadius() +
+                    objB->getAngularVelocity().magnitude() * objB->getBoundingRadius()) * duration;
+    return motion > CCD_MOTION_RATIO * std::min(thinnestHalfExtent(objA), thinnestHalfExtent(objB));
+}
+
+// 휴면 판정 프레임 수 설정 (0이면 휴면 사용 안 함)
+void CollisionManager::setSleepThreshold(int frames) {
+    sleepThreshold = std::max(0, frames);
+    if (sleepThreshold == 0) {
+        for (auto* obj : objects) {
+            obj->sleeping = false;
+        }
+    }
+}
+
+// 휴면 중이거나 지난 검사 이후 움직이지 않은 정적 객체 (쌍의 두 객체가 모두 쉬면 정밀 검사 생략)
+bool CollisionManager::isResting(const Object3D* object) const {
+    if (object->bodyType == BodyType::STATIC) {
+        return !object->movedSinceCheck;
+    }
+    return object->sleeping;
+}
+
+size_t CollisionManager::getSleepingCount() const {
+    size_t count = 0;
+    for (auto* obj : objects) {
+        if (obj->sleeping) {
+            count++;
+        }
+    }
+    return count;
+}
+
+// 객체를 깨우고, 마지막으로 계산한 접촉 섬이 유효하면 섬 전체를 깨움
+void CollisionManager::wakeObject(Object3D* object) {
+    if (object == nullptr) {
+        return;
+    }
+    if (!object->sleeping || !islandsValid || object->islandIndex < 0) {
+        object->sleeping = false;
+        object->idleFrames = 0;
+        return;
+    }
+
+    int island = object->islandIndex;
+    for (int i = islandStart[island]; i < islandStart[island + 1]; ++i) {
+        islandMembers[i]->sleeping = false;
+        islandMembers[i]->idleFrames = 0;
+    }
+}
+
+// union-find 루트 (경로 절반 압축)
+int CollisionManager::findIsland(int index) {
+    while (islandParent[index] != index) {
+        islandParent[index] = islandParent[islandParent[index]];
+        index = islandParent[index];
+    }
+    return index;
+}
+
+// 충돌 중인 쌍으로 움직이는 객체를 접촉 섬으로 묶고, 섬 전체가 sleepThreshold 프레임 이상
+// 멈춰 있으면 휴면 (정적 객체는 섬을 잇지 않음)
+void CollisionManager::updateIslands() {
+    int count = static_cast<int>(objects.size());
+    islandParent.resize(count);
+    for (int i = 0; i < count; ++i) {
+        islandParent[i] = i;
+        objects[i]->islandIndex = i;
+    }
+    for (auto* obj : staticObjects) {
+        obj->islandIndex = -1;
+    }
+
+    for (const auto& pair : pairManager.getPairs()) {
+        if (!pair.colliding) {
+            continue;
+        }
+        int a = pair.objectA->islandIndex;
+        int b = pair.objectB->islandIndex;
+        if (a < 0 || b < 0) {
+            continue;
+        }
+        a = findIsland(a);
+        b = findIsland(b);
+        if (a != b) {
+            islandParent[a] = b;
+        }
+    }
+
+    // 루트마다 섬 번호 부여 (루트의 islandStart 칸을 임시로 섬 번호 저장에 사용)
+    islandStart.assign(count + 1, -1);
+    int islandCount = 0;
+    for (int i = 0; i < count; ++i) {
+        int root = findIsland(i);
+        if (islandStart[root] < 0) {
+            islandStart[root] = islandCount++;
+        }
+        objects[i]->islandIndex = islandStart[root];
+    }
+
+    // 섬별 객체 수 → 시작 위치 (CSR)
+    islandStart.assign(islandCount + 1, 0);
+    for (int i = 0; i < count; ++i) {
+        islandStart[objects[i]->islandIndex + 1]++;
+    }
+    for (int k = 0; k < islandCount; ++k) {
+        islandStart[k + 1] += islandStart[k];
+    }
+
+    // 섬 번호 순으로 객체 나열 (islandParent를 섬별 기록 위치로 재사용)
+    islandMembers.resize(count);
+    islandParent.assign(islandStart.begin(), islandStart.end() - 1);
+    for (int i = 0; i < count; ++i) {
+        islandMembers[islandParent[objects[i]->islandIndex]++] = objects[i];
+    }
+    islandsValid = true;
+
+    // 섬에서 가장 최근에 움직인 객체 기준으로 휴면 판정
+    for (int k = 0; k < islandCount; ++k) {
+        int minIdle = std::numeric_limits<int>::max();
+        for (int i = islandStart[k]; i < islandStart[k + 1]; ++i) {
+            minIdle = std::min(minIdle, islandMembers[i]->idleFrames);
+        }
+
+        bool sleep = sleepThreshold > 0 && minIdle >= sleepThreshold;
+        for (int i = islandStart[k]; i < islandStart[k + 1]; ++i) {
+            islandMembers[i]->sleeping = sleep;
+        }
+    }
+}
+
 // 대략적 충돌 감지 (Broad Phase)
 void CollisionManager::broadPhase(std::vector<std::pair<Object3D*, Object3D*>>& potentialCollisions) {
     potentialCollisions.clear();
-    
-    // 모든 객체 쌍에 대해 AABB 충돌 검사
+
+    switch (broadPhaseAlgorithm) {
+        case CollisionAlgorithm::SAP:
+            // 끝점 목록을 삽입 정렬로 갱신하고 유지 중인 겹침 쌍을 그대로 사용
+            sweepAndPrune.update();
+            sweepAndPrune.getPairs(potentialCollisions);
+            filterPairs(potentialCollisions);
+            break;
+        case CollisionAlgorithm::BVH:
+            // fat AABB를 벗어난 객체만 재삽입한 뒤 트리 자기 순회로 쌍 수집
+            dynamicTree.update();
+            dynamicTree.findCollisionPairs(potentialCollisions);
+            filterPairs(potentialCollisions);
+            break;
+        case CollisionAlgorithm::SPATIAL_HASH:
+            spatialHashBroadPhase(potentialCollisions);
+            break;
+        case CollisionAlgorithm::LBVH:
+            linearTreeBroadPhase(potentialCollisions);
+            break;
+        default:
+            bruteForceBroadPhase(potentialCollisions);
+            break;
+    }
+
+    // 정적 객체는 정적 BVH로 움직이는 객체와만 검사 (정적 객체끼리의 쌍은 만들지 않음)
+    queryStaticTree(potentialCollisions);
+}
+
+// 움직이는 객체들의 월드 AABB를 SoA 배열로 복사
+void CollisionManager::refreshWorldBounds() {
+    worldBounds.resize(objects.size());
     for (size_t i = 0; i < objects.size(); ++i) {
-        for (size_t j = i + 1; j < objects.size(); ++j) {
-            Object3D* objA = objects[i];
-            Object3D* objB = objects[j];
-            
-            // AABB 충돌 검사
-            if (checkAABBCollision(objA, objB)) {
-                potentialCollisions.emplace_back(objA, objB);
+        worldBounds.set(i, objects[i]->getAABB());
+    }
+}
+
+// 현재 객체 목록으로 선형 BVH를 다시 구축하고 리프별 병렬 질의로 쌍 수집
+// 객체 목록을 그대로 쓰므로 별도의 등록/제거가 필요 없음
+void CollisionManager::linearTreeBroadPhase(std::vector<std::pair<Object3D*, Object3D*>>& potentialCollisions) {
+    linearTree.build(worldBounds);
+
+    indexPairs.clear();
+    linearTree.findCollisionPairs(indexPairs);
+    for (const auto& pair : indexPairs) {
+        if (canCollide(objects[pair.first], objects[pair.second])) {
+            potentialCollisions.emplace_back(objects[pair.first], objects[pair.second]);
+        }
+    }
+}
+
+// 격자 셀마다 쌍을 찾고 교집합이 시작되는 셀에서만 보고해 중복 제거
+void CollisionManager::spatialHashBroadPhase(std::vector<std::pair<Object3D*, Object3D*>>& potentialCollisions) {
+    indexPairs.clear();
+    spatialHash.findCollisionPairs(worldBounds, indexPairs);
+    for (const auto& pair : indexPairs) {
+        if (canCollide(objects[pair.first], objects[pair.second])) {
+            potentialCollisions.emplace_back(objects[pair.first], objects[pair.second]);
+        }
+    }
+}
+
+// 모든 객체 쌍의 AABB를 검사하는 O(n^2) 대략적 충돌 감지
+// 객체 하나를 뒤쪽 객체 전체와 SIMD로 한 번에 검사
+void CollisionManager::bruteForceBroadPhase(std::vector<std::pair<Object3D*, Object3D*>>& potentialCollisions) {
+    size_t count = worldBounds.size();
+    overlapScratch.resize(count);
+
+    for (size_t i = 0; i + 1 < count; ++i) {
+        size_t hitCount = worldBounds.overlapBatch(worldBounds.get(i), i + 1, count, overlapScratch.data());
+        for (size_t h = 0; h < hitCount; ++h) {
+            Object3D* objB = objects[overlapScratch[h]];
+            if (canCollide(objects[i], objB)) {
+                potentialCollisions.emplace_back(objects[i], objB);
             }
         }
     }
 }
 
+// 두 객체의 접촉 다양체 조회
+const Collision::ContactManifold* CollisionManager::getContactManifold(const Object3D* objA, const Object3D* objB) {
+    Collision::CollisionPair* pair = pairManager.find(objA->collisionId, objB->collisionId);
+    return pair ? pairManager.getManifold(*pair) : nullptr;
+}
+
 // 정밀 충돌 감지 (Narrow Phase)
-bool CollisionManager::narrowPhase(Object3D* objA, Object3D* objB, CollisionInfo& collisionInfo) {
-    switch (narrowPhaseAlgorithm) {
-        case CollisionAlgorithm::GJK:
-            return checkGJKCollision(objA, objB, collisionInfo);
-        case CollisionAlgorithm::SAT:
-            return checkSATCollision(objA, objB, collisionInfo);
-        case CollisionAlgorithm::AABB:
-            // AABB는 충돌 정보를 제공하지 않으므로, 단순 충돌 여부만 반환
-            return checkAABBCollision(objA, objB);
-        case CollisionAlgorithm::CUSTOM:
-            // 필요에 따라 사용자 정의 알고리즘 구현
-            return false;
-        default:
-            return false;
+bool CollisionManager::narrowPhase(Object3D* objA, Object3D* objB, CollisionInfo& collisionInfo,
+                                   Collision::CollisionPair& pair, Collision::ContactManifold& manifold) {
+    bool exact = narrowPhaseAlgorithm == CollisionAlgorithm::GJK || narrowPhaseAlgorithm == CollisionAlgorithm::SAT;
+    bool colliding = false;
+    
+    if (exact && Collision::ShapeCollider::HasClosedForm(objA->getShapeType(), objB->getShapeType())) {
+        // 닫힌 식이 있는 기본 도형 쌍은 GJK/SAT 대신 도형끼리 바로 검사
+        colliding = checkShapeCollision(objA, objB, collisionInfo, manifold);
+    } else {
+        switch (narrowPhaseAlgorithm) {
+            case CollisionAlgorithm::GJK:
+                colliding = checkGJKCollision(objA, objB, collisionInfo, pair, manifold);
+                break;
+            case CollisionAlgorithm::SAT:
+                colliding = checkSATCollision(objA, objB, collisionInfo, pair, manifold);
+                break;
+            case CollisionAlgorithm::AABB:
+                // AABB는 충돌 정보를 제공하지 않으므로, 단순 충돌 여부만 반환 (연속 검사 중이면 스윕 AABB끼리 비교)
+                return checkAABBCollision(objA, objB);
+            case CollisionAlgorithm::CUSTOM:
+                // 필요에 따라 사용자 정의 알고리즘 구현
+                return false;
+            default:
+                return false;
+        }
     }
+    
+    // 현재 자세에서 떨어져 있어도 검사 구간 안에 지나쳐 버릴 수 있는 빠른 쌍은 충돌 시각을 찾음
+    if (!colliding && exact && continuousDetection && isFastPair(objA, objB)) {
+        colliding = checkTimeOfImpact(objA, objB, collisionInfo, manifold);
+    }
+    return colliding;
 }
 
 // 두 객체가 AABB가 교차하는지 확인
@@ -212,147 +817,506 @@ bool CollisionManager::checkAABBCollision(Object3D* objA, Object3D* objB) {
 }
 
 // GJK 충돌 감지 (Gilbert-Johnson-Keerthi 알고리즘)
-bool CollisionManager::checkGJKCollision(Object3D* objA, Object3D* objB, CollisionInfo& collisionInfo) {
-    std::cout << ">> checkGJKCollision 시작: " << objA->getName() << " vs " << objB->getName() << std::endl;
-    
-    // 객체 위치 가져오기
-    Vector3 posA = objA->getPosition();
-    Vector3 posB = objB->getPosition();
+bool CollisionManager::checkGJKCollision(Object3D* objA, Object3D* objB, CollisionInfo& collisionInfo,
+                                         Collision::CollisionPair& pair,
+                                         Collision::ContactManifold& manifold) {
+    // 회전/스케일을 포함한 객체 변환
+    Transform transformA = objA->getTransform();
+    Transform transformB = objB->getTransform();
     
-    std::cout << "  객체 위치: " << objA->getName() << "=(" << posA.toString() << ")"
-            << ", " << objB->getName() << "=(" << posB.toString() << ")" << std::endl;
-
-
-    // objA와 objB가 볼록 분해되어 있는지 확인
-    std::cout << "  객체 분해 상태: " << objA->getName() << "=" << (objA->isDecomposed() ? "분해됨" : "분해 안됨")
-              << ", " << objB->getName() << "=" << (objB->isDecomposed() ? "분해됨" : "분해 안됨") << std::endl;
+    // 분해된 객체는 볼록 껍질 목록, 아니면 단일 볼록체 (메시 정점, 기본 도형은 도형 다면체)
+    bool decomposedA = usesHullList(objA);
+    bool decomposedB = usesHullList(objB);
+    const ConvexHull* hullsA = nullptr;
+    const ConvexHull* hullsB = nullptr;
+    size_t countA = 0, countB = 0;
+    collisionHulls(objA, hullsA, countA);
+    collisionHulls(objB, hullsB, countB);
     
-    if (objA->isDecomposed() && objB->isDecomposed()) {
-        // 두 객체의 볼록 껍질들 간의 충돌 검사
-        const std::vector<ConvexHull>& hullsA = objA->getConvexHulls();
-        const std::vector<ConvexHull>& hullsB = objB->getConvexHulls();
+    // 충돌하는 껍질 쌍 중 가장 깊이 침투한 쌍의 접촉 정보를 사용
+    // 지원점/웜 스타트 캐시는 실제로 검사한 껍질 쌍만 PairManager 풀에 가짐
+    // 후보 껍질 쌍마다 불리므로 콘솔 출력 없이 결과만 모음
+    bool colliding = false;
+    size_t candidatePairs = 0;
+    auto testHullPair = [&](int hullIndexA, int hullIndexB) {
+        const ConvexHull& hullA = hullsA[hullIndexA];
+        const ConvexHull& hullB = hullsB[hullIndexB];
+        candidatePairs++;
         
-        std::cout << "  볼록 껍질 개수: " << objA->getName() << "=" << hullsA.size() 
-                  << ", " << objB->getName() << "=" << hullsB.size() << std::endl;
+        Collision::Simplex simplex;
+        Collision::GJKCache& cache = pairManager.hullCache(pair, hullIndexA, hullIndexB).gjk;
+        if (!gjkSolver.Intersect(hullA, transformA, hullB, transformB, simplex, &cache)) {
+            return;
+        }
+        
+        CollisionInfo hullInfo;
+        Collision::EPAResult epaResult;
+        if (!epaCalculatePenetration(hullA, transformA, hullB, transformB, simplex, hullInfo, epaResult)) {
+            // 표면만 맞닿은 납작한 접촉 (깊이 0): 이 껍질 쌍은 침투로 보지 않고 건너뜀
+            return;
+        }
         
-        int hullACounter = 0;
-        for (const ConvexHull& hullA : hullsA) {
-            hullACounter++;
-            std::cout << "    " << objA->getName() << "의 껍질 #" << hullACounter 
-                      << " (정점 수: " << hullA.vertices.size() << ")" << std::endl;
+        if (!colliding || hullInfo.penetrationDepth > collisionInfo.penetrationDepth) {
+            collisionInfo = hullInfo;
+            collisionInfo.otherObject = objB;
             
-            int hullBCounter = 0;
-            for (const ConvexHull& hullB : hullsB) {
-                hullBCounter++;
-                std::cout << "      " << objB->getName() << "의 껍질 #" << hullBCounter 
-                          << " (정점 수: " << hullB.vertices.size() << ")" << std::endl;
-                
-                // GJK로 충돌 확인
-                std::cout << "      GJK 충돌 검사 시작..." << std::endl;
-                bool result = false;
-                try {
-                    result = gjkSolver.Intersect(hullA, hullB, posA, posB);
-                    std::cout << "      GJK 결과: " << (result ? "충돌" : "충돌 없음") << std::endl;
-                } catch (const std::exception& e) {
-                    std::cout << "      GJK 예외 발생: " << e.what() << std::endl;
-                } catch (...) {
-                    std::cout << "      GJK에서 알 수 없는 예외 발생" << std::endl;
-                }
-                
-                if (result) {
-                    std::cout << "      충돌 감지됨! 충돌 정보 설정 중..." << std::endl;
-                    // 충돌 정보 계산 - EPA 알고리즘을 구현해야 함
-                    // 임시로 기본값 설정
-                    collisionInfo.otherObject = objB;
-                    collisionInfo.contactPoint = (objA->getPosition() + objB->getPosition()) * 0.5f;
-                    collisionInfo.contactNormal = (objB->getPosition() - objA->getPosition()).normalized();
-                    collisionInfo.penetrationDepth = 0.1f;  // 임시값
-                    
-                    std::cout << "  checkGJKCollision 완료: 충돌 감지" << std::endl;
-                    return true;
-                }
+            // 가장 깊은 껍질 쌍의 접촉 다양체
+            manifold.clear();
+            manifoldBuilder.FromEPA(hullA, transformA, hullB, transformB, epaResult, manifold);
+            manifold.hullA = hullIndexA;
+            manifold.hullB = hullIndexB;
+        }
+        colliding = true;
+    };
+    
+    if (decomposedA && decomposedB) {
+        // 중간 단계: B의 로컬 좌표를 A의 로컬 좌표로 옮기는 상대 변환 아래에서 두 껍질 BVH를 동시에 순회해
+        // 로컬 AABB가 겹치는 껍질 쌍만 GJK로 검사
+        Transform bToA = transformA.inverse() * transformB;
+        objA->getHullTree().queryTree(objB->getHullTree(), bToA, testHullPair);
+    } else {
+        // 한쪽이 단일 볼록체면 다른 쪽 껍질 전부와 검사
+        for (size_t i = 0; i < countA; ++i) {
+            for (size_t j = 0; j < countB; ++j) {
+                testHullPair(static_cast<int>(i), static_cast<int>(j));
             }
         }
-        std::cout << "  모든 볼록 껍질 쌍 검사 완료, 충돌 없음" << std::endl;
+    }
+    
+    if (narrowPhaseLogging) {
+        std::cout << "  GJK " << objA->getName() << " vs " << objB->getName() << ": 껍질 쌍 " << candidatePairs
+                  << " / " << countA * countB << " 검사, " << (colliding ? "충돌" : "충돌 없음") << std::endl;
+    }
+    return colliding;
+}
+
+// SAT 충돌 감지 (Separating Axis Theorem)
+// 조밀한 OBB로 먼저 거르고, 겹치면 볼록 다면체 SAT로 침투 깊이와 법선을 계산
+// 분해된 객체는 볼록 껍질을, 분해되지 않은 객체는 OBB를 상자 껍질로 사용
+bool CollisionManager::checkSATCollision(Object3D* objA, Object3D* objB, CollisionInfo& collisionInfo,
+                                         Collision::CollisionPair& pair,
+                                         Collision::ContactManifold& manifold) {
+    // 로드 시 맞춘 조밀한 로컬 OBB를 각 객체의 자세로 변환
+    OBB obbA = objA->getOBB();
+    OBB obbB = objB->getOBB();
+    
+    // OBB가 분리되면 다면체 검사 없이 종료
+    if (!obbA.intersects(obbB)) {
         return false;
     }
-    else {
-        std::cout << "  비분해 객체 처리: 단일 ConvexHull 생성" << std::endl;
-        // 볼록 분해되지 않은 객체는 단일 ConvexHull로 처리
-        ConvexHull hullA, hullB;
-        
-        // 임시 ConvexHull 생성
-        hullA.vertices = objA->getVertices();
-        hullB.vertices = objB->getVertices();
-        
-        std::cout << "  생성된 ConvexHull 정점 수: " << objA->getName() << "=" << hullA.vertices.size() 
-                  << ", " << objB->getName() << "=" << hullB.vertices.size() << std::endl;
-        
-        // GJK로 충돌 확인
-        std::cout << "  GJK 충돌 검사 시작..." << std::endl;
-        bool result = false;
-        try {
-            result = gjkSolver.Intersect(hullA, hullB, posA, posB);
-            std::cout << "  GJK 결과: " << (result ? "충돌" : "충돌 없음") << std::endl;
-        } catch (const std::exception& e) {
-            std::cout << "  GJK 예외 발생: " << e.what() << std::endl;
-        } catch (...) {
-            std::cout << "  GJK에서 알 수 없는 예외 발생" << std::endl;
+    
+    // 기본 도형은 도형 다면체 하나를 객체 변환으로 검사
+    const ConvexHull& box = Collision::HullSAT::unitBox();
+    bool decomposedA = usesHullList(objA);
+    bool decomposedB = usesHullList(objB);
+    bool primitiveA = objA->getShape().isPrimitive();
+    bool primitiveB = objB->getShape().isPrimitive();
+    const ConvexHull* hullsA = decomposedA ? objA->getConvexHulls().data() : (primitiveA ? &objA->getCollisionHull() : &box);
+    const ConvexHull* hullsB = decomposedB ? objB->getConvexHulls().data() : (primitiveB ? &objB->getCollisionHull() : &box);
+    size_t countA = decomposedA ? objA->getConvexHulls().size() : 1;
+    size_t countB = decomposedB ? objB->getConvexHulls().size() : 1;
+    Transform transformA = (decomposedA || primitiveA) ? objA->getTransform() : Collision::HullSAT::boxTransform(obbA);
+    Transform transformB = (decomposedB || primitiveB) ? objB->getTransform() : Collision::HullSAT::boxTransform(obbB);
+    
+    // 충돌하는 껍질 쌍 중 가장 깊이 침투한 쌍의 접촉 정보를 사용 (후보 껍질 쌍마다의 콘솔 출력 없음)
+    // 분리 축 캐시는 실제로 검사한 껍질 쌍만 PairManager 풀에 가짐
+    bool colliding = false;
+    size_t candidatePairs = 0;
+    auto testHullPair = [&](int hullIndexA, int hullIndexB) {
+        candidatePairs++;
+        Collision::SATResult result;
+        Collision::SATCache& cache = pairManager.hullCache(pair, hullIndexA, hullIndexB).sat;
+        if (!satSolver.Intersect(hullsA[hullIndexA], transformA, hullsB[hullIndexB], transformB, result, &cache)) {
+            return;
         }
         
-        if (result) {
-            std::cout << "  충돌 감지됨! 충돌 정보 설정 중..." << std::endl;
-            // 임시 충돌 정보
+        float depth = -result.separation;
+        if (!colliding || depth > collisionInfo.penetrationDepth) {
+            // 접촉점: A 안으로 가장 깊이 들어간 B의 점과 그 점을 A 표면으로 옮긴 점의 중간
+            Vector3 deepestB = hullsB[hullIndexB].support(-result.normal, transformB);
             collisionInfo.otherObject = objB;
-            collisionInfo.contactPoint = (objA->getPosition() + objB->getPosition()) * 0.5f;
-            collisionInfo.contactNormal = (objB->getPosition() - objA->getPosition()).normalized();
-            collisionInfo.penetrationDepth = 0.1f;  // 임시값
+            collisionInfo.contactNormal = result.normal;
+            collisionInfo.penetrationDepth = depth;
+            collisionInfo.contactPoint = deepestB + result.normal * (depth * 0.5f);
             
-            std::cout << "  checkGJKCollision 완료: 충돌 감지" << std::endl;
-            return true;
+            // 기준 면/입사 면 자르기로 접촉 다양체 (자를 수 없으면 위 접촉점 한 점)
+            if (!manifoldBuilder.FromSAT(hullsA[hullIndexA], transformA, hullsB[hullIndexB], transformB, result, manifold)) {
+                Collision::ManifoldBuilder::SinglePoint(transformA, transformB, result.normal,
+                                                        deepestB + result.normal * depth, deepestB, depth, manifold);
+            }
+            manifold.hullA = hullIndexA;
+            manifold.hullB = hullIndexB;
         }
-        
-        std::cout << "  checkGJKCollision 완료: 충돌 없음" << std::endl;
+        colliding = true;
+    };
+    
+    if (decomposedA && decomposedB) {
+        // 중간 단계: 로컬 AABB가 겹치는 껍질 쌍만 검사
+        Transform bToA = transformA.inverse() * transformB;
+        objA->getHullTree().queryTree(objB->getHullTree(), bToA, testHullPair);
+    } else {
+        for (size_t i = 0; i < countA; ++i) {
+            for (size_t j = 0; j < countB; ++j) {
+                testHullPair(static_cast<int>(i), static_cast<int>(j));
+            }
+        }
+    }
+    
+    if (narrowPhaseLogging) {
+        std::cout << "  SAT " << objA->getName() << " vs " << objB->getName() << ": 껍질 쌍 " << candidatePairs
+                  << " / " << countA * countB << " 검사, " << (colliding ? "충돌" : "충돌 없음") << std::endl;
+    }
+    return colliding;
+}
+
+// 기본 도형 닫힌 식 검사 (구-구, 구-캡슐, 캡슐-캡슐, 구-상자, 상자-상자)
+bool CollisionManager::checkShapeCollision(Object3D* objA, Object3D* objB, CollisionInfo& collisionInfo,
+                                           Collision::ContactManifold& manifold) {
+    std::cout << ">> checkShapeCollision 시작: " << objA->getName() << " vs " << objB->getName() << std::endl;
+    
+    WorldShape shapeA = objA->getWorldShape();
+    WorldShape shapeB = objB->getWorldShape();
+    
+    float depth = 0.0f;
+    if (!shapeCollider.Collide(shapeA, objA->getTransform(), shapeB, objB->getTransform(), manifold, depth)) {
+        std::cout << "  checkShapeCollision 완료: 충돌 없음" << std::endl;
         return false;
     }
+    
+    manifold.hullA = 0;
+    manifold.hullB = 0;
+    collisionInfo.otherObject = objB;
+    collisionInfo.contactNormal = manifold.normal;
+    collisionInfo.penetrationDepth = depth;
+    collisionInfo.contactPoint = manifold.center();
+    std::cout << "  침투 깊이: " << collisionInfo.penetrationDepth << std::endl;
+    std::cout << "  checkShapeCollision 완료: 충돌 감지" << std::endl;
+    return true;
 }
 
-// SAT 충돌 감지 (Separating Axis Theorem)
-bool CollisionManager::checkSATCollision(Object3D* objA, Object3D* objB, CollisionInfo& collisionInfo) {
-    // AABB를 가져옵니다
-    const AABB& aabbA = objA->getAABB();
-    const AABB& aabbB = objB->getAABB();
+// 보수적 전진 (Conservative Advancement, Mirtich)
+// 시각 t의 자세에서 두 객체의 최단 거리 d와 A에서 B로 향하는 분리축 n을 GJK 거리 질의로 구하면
+// 두 객체가 n 방향으로 가까워지는 속도는 (vA - vB)·n + |wA| rA + |wB| rB 를 넘지 않으므로
+// t를 d / (그 상한)만큼 전진해도 겹치지 않는다. 거리가 허용값 안에 들어오면 그 시각이 충돌 시각
+bool CollisionManager::checkTimeOfImpact(Object3D* objA, Object3D* objB, CollisionInfo& collisionInfo,
+                                         Collision::ContactManifold& manifold) {
+    const ConvexHull* hullsA = nullptr;
+    const ConvexHull* hullsB = nullptr;
+    size_t countA = 0, countB = 0;
+    collisionHulls(objA, hullsA, countA);
+    collisionHulls(objB, hullsB, countB);
     
-    // OBB 생성 - 먼저 AABB로부터 생성하고 나서 변환 적용
-    OBB obbA(aabbA);
-    obbA.center = objA->getPosition();
-    obbA.orientation = objA->getTransformMatrix();
-    
-    OBB obbB(aabbB);
-    obbB.center = objB->getPosition();
-    obbB.orientation = objB->getTransformMatrix();
-    
-    // OBB의 intersects 메서드 사용
-    if (obbA.intersects(obbB)) {
-        // 충돌 정보 설정
-        collisionInfo.otherObject = objB;
-        collisionInfo.contactPoint = (objA->getPosition() + objB->getPosition()) * 0.5f;
-        collisionInfo.contactNormal = (objB->getPosition() - objA->getPosition()).normalized();
-        collisionInfo.penetrationDepth = 0.1f;  // 임시값
+    float duration = sweepDuration();
+    Vector3 relativeVelocity = objA->getLinearVelocity() - objB->getLinearVelocity();
+    float angularBound = objA->getAngularVelocity().magnitude() * objA->getBoundingRadius() +
+                         objB->getAngularVelocity().magnitude() * objB->getBoundingRadius();
+    
+    // 중간 단계: 구간 동안 두 객체 위의 점 사이 거리는 (|vA - vB| + angularBound) * duration 넘게 줄지 않으므로
+    // 시작 자세에서 그만큼(과 허용 오차) 떨어진 껍질 쌍은 닿을 수 없음. 풀이마다 한 번만 거르고 반복에서는 남은 쌍만 검사
+    float margin = (relativeVelocity.magnitude() + angularBound) * duration + CCD_TOLERANCE;
+    Transform startA = objA->getTransform();
+    Transform startB = objB->getTransform();
+    ccdPairs.clear();
+    auto addHullPair = [&](int hullIndexA, int hullIndexB) {
+        if (!hullsA[hullIndexA].vertices.empty() && !hullsB[hullIndexB].vertices.empty()) {
+            ccdPairs.push_back(CCDHullPair{ hullIndexA, hullIndexB, Collision::GJKCache() });
+        }
+    };
+    if (usesHullList(objA) && usesHullList(objB)) {
+        // 껍질 BVH는 A 로컬(스케일 전) 단위이므로 월드 여유를 A의 가장 작은 스케일로 나눠 로컬 여유로 바꿈
+        const Vector3& scale = objA->getScale();
+        float minScale = std::min({ std::abs(scale.x), std::abs(scale.y), std::abs(scale.z) });
+        float localMargin = margin / std::max(minScale, 1e-6f);
+        objA->getHullTree().queryTree(objB->getHullTree(), startA.inverse() * startB, addHullPair, localMargin);
+    } else if (usesHullList(objA)) {
+        AABB boundsB = inflateBounds(hullBounds(hullsB[0], startB), margin);
+        objA->getHullTree().query(transformBounds(boundsB, startA.inverse()), [&](int index) {
+            addHullPair(index, 0);
+        });
+    } else if (usesHullList(objB)) {
+        AABB boundsA = inflateBounds(hullBounds(hullsA[0], startA), margin);
+        objB->getHullTree().query(transformBounds(boundsA, startB.inverse()), [&](int index) {
+            addHullPair(0, index);
+        });
+    } else {
+        addHullPair(0, 0);
+    }
+    if (ccdPairs.empty()) {
+        return false;
+    }
+    
+    float time = 0.0f;
+    int iteration = 0;
+    Transform transformA, transformB;
+    Collision::GJKDistanceResult closest;
+    int closestA = 0, closestB = 0;
+    while (true) {
+        // 시각 time의 자세에서 남은 껍질 쌍 중 최단 거리 (걸러진 쌍은 구간 안에 허용 오차까지 가까워지지 않음)
+        transformA = objA->getTransformAt(time);
+        transformB = objB->getTransformAt(time);
+        closest.distance = std::numeric_limits<float>::max();
+        for (CCDHullPair& candidate : ccdPairs) {
+            Collision::GJKDistanceResult result;
+            gjkSolver.Distance(hullsA[candidate.hullA], transformA, hullsB[candidate.hullB], transformB, result,
+                               &candidate.cache);
+            if (result.distance < closest.distance) {
+                closest = result;
+                closestA = candidate.hullA;
+                closestB = candidate.hullB;
+            }
+        }
+        
+        if (closest.distance <= CCD_TOLERANCE) {
+            break;
+        }
+        if (++iteration >= CCD_MAX_ITERATIONS) {
+            // 반복 한도: 마지막 자세에서도 거리가 허용 오차보다 크므로 닿았다고 볼 수 없음 (이산 검사 결과 유지)
+            return false;
+        }
         
-        return true;
+        float closingSpeed = relativeVelocity.dot(closest.separatingAxis) + angularBound;
+        if (closingSpeed <= 0.0f) {
+            return false;
+        }
+        time += closest.distance / closingSpeed;
+        if (time > duration) {
+            return false;
+        }
+    }
+    
+    // 충돌 시각의 최근접점 사이 방향을 법선으로 (이미 닿아 분리축이 없으면 상대 이동 방향)
+    Vector3 normal = closest.separatingAxis;
+    if (normal.magnitudeSquared() < 1e-12f) {
+        normal = relativeVelocity.magnitudeSquared() > 1e-12f ? relativeVelocity.normalized() : Vector3(0, 1, 0);
+    }
+    
+    manifold.clear();
+    Collision::ManifoldBuilder::SinglePoint(transformA, transformB, normal, closest.pointA, closest.pointB, 0.0f,
+                                            manifold);
+    manifold.hullA = closestA;
+    manifold.hullB = closestB;
+    
+    collisionInfo.otherObject = objB;
+    collisionInfo.contactNormal = normal;
+    collisionInfo.contactPoint = (closest.pointA + closest.pointB) * 0.5f;
+    collisionInfo.penetrationDepth = 0.0f;
+    collisionInfo.timeOfImpact = time;
+    return true;
+}
+
+// 여러 광선을 한 번에 질의 (준비는 한 번, 광선은 스레드별로 나눠 처리)
+void CollisionManager::raycastBatch(const Ray* rays, RayHit* hits, size_t count) {
+    prepareRaycast();
+    
+    int rayCount = static_cast<int>(count);
+    #pragma omp parallel for schedule(dynamic, 64)
+    for (int i = 0; i < rayCount; ++i) {
+        hits[i] = RayHit();
+        traceRay(rays[i], hits[i]);
+    }
+}
+
+// 광선 하나 질의 (객체 BVH는 객체가 움직이지 않았으면 지난 질의 것을 그대로 씀)
+bool CollisionManager::raycast(const Ray& ray, RayHit& hit) {
+    prepareRaycast();
+    hit = RayHit();
+    return traceRay(ray, hit);
+}
+
+// 객체 변환/AABB를 갱신하고 움직이는 객체 BVH를 현재 AABB로 구축
+// update()가 돌았거나 객체가 움직인 뒤 첫 질의 때만 다시 만들고, 그 사이의 질의는 지난 구조를 재사용
+void CollisionManager::prepareRaycast() {
+    if (staticTreeDirty) {
+        rebuildStaticTree();
+    }
+    if (!rayTreeDirty) {
+        return;
     }
     
-    return false;
+    std::vector<AABB> bounds;
+    bounds.reserve(objects.size());
+    rayTransforms.clear();
+    rayInverses.clear();
+    for (auto* obj : objects) {
+        obj->update();
+        bounds.push_back(obj->getAABB());
+        rayTransforms.push_back(obj->getTransform());
+        rayInverses.push_back(rayTransforms.back().inverse());
+    }
+    for (auto* obj : staticObjects) {
+        rayTransforms.push_back(obj->getTransform());
+        rayInverses.push_back(rayTransforms.back().inverse());
+    }
+    rayTree.build(bounds);
+    rayTreeDirty = false;
+}
+
+// 움직이는 객체 BVH와 정적 BVH를 차례로 내려가며 가장 가까운 교차를 찾음
+// 앞 트리에서 찾은 거리가 뒤 트리의 탐색 범위를 줄임
+bool CollisionManager::traceRay(const Ray& ray, RayHit& hit) const {
+    float length = ray.direction.magnitude();
+    if (length < 1e-12f || !(ray.maxDistance >= 0.0f)) {
+        return false;
+    }
+    
+    RaySlab slab(ray.origin, ray.direction / length);
+    float maxDistance = ray.maxDistance;
+    bool found = false;
+    auto visit = [&](Object3D* object, size_t transformIndex, float& limit) {
+        if ((object->getCollisionCategory() & ray.mask) == 0) {
+            return;
+        }
+        if (raycastObject(object, transformIndex, slab, limit, hit)) {
+            limit = hit.distance;
+            found = true;
+        }
+    };
+    
+    rayTree.raycast(slab, maxDistance, [&](int index, float& limit) {
+        visit(objects[index], index, limit);
+    });
+    staticTree.raycast(slab, maxDistance, [&](int index, float& limit) {
+        visit(staticObjects[index], objects.size() + index, limit);
+    });
+    return found;
+}
+
+// 광선을 객체 로컬 좌표로 옮겨 볼록 껍질(분해된 객체는 껍질 BVH로 거른 껍질들)과 검사
+// 로컬 방향은 정규화하지 않으므로 로컬에서 구한 t가 그대로 월드 거리
+bool CollisionManager::raycastObject(Object3D* object, size_t transformIndex, const RaySlab& ray,
+                                     float maxDistance, RayHit& hit) const {
+    const Transform& inverse = rayInverses[transformIndex];
+    Vector3 origin = inverse.transformPoint(ray.origin);
+    Vector3 direction = inverse.basis * ray.direction;
+    
+    float best = maxDistance;
+    int bestHull = -1;
+    Vector3 localNormal;
+    if (usesHullList(object)) {
+        const std::vector<ConvexHull>& hulls = object->getConvexHulls();
+        RaySlab localRay(origin, direction);
+        object->getHullTree().raycast(localRay, best, [&](int index, float& limit) {
+            float t;
+            int face;
+            if (hulls[index].raycast(origin, direction, limit, t, face)) {
+                limit = t;
+                bestHull = index;
+                localNormal = hulls[index].faces[face].normal;
+            }
+        });
+    } else {
+        // 기본 도형은 도형 다면체, 메시만 있는 객체는 메시 삼각형
+        const ConvexHull& hull = object->getCollisionHull();
+        float t;
+        int face;
+        if (hull.hasFeatures()) {
+            if (hull.raycast(origin, direction, best, t, face)) {
+                best = t;
+                bestHull = 0;
+                localNormal = hull.faces[face].normal;
+            }
+        } else if (raycastTriangles(object->getVertices(), object->getIndices(), origin, direction, best,
+                                    t, localNormal)) {
+            best = t;
+            bestHull = 0;
+        }
+    }
+    
+    if (bestHull < 0) {
+        return false;
+    }
+    hit.object = object;
+    hit.distance = best;
+    hit.point = ray.origin + ray.direction * best;
+    hit.normal = (rayTransforms[transformIndex].normalMatrix() * localNormal).normalized();
+    hit.hull = bestHull;
+    return true;
+}
+
+// 객체 이동 질의
+// 이동 전후 AABB를 감싸는 스윕 AABB로 움직이는 객체(SoA AABB 일괄 검사)와 정적 객체(정적 BVH)에서 후보를 고름
+bool CollisionManager::shapeCast(Object3D* object, const Vector3& translation, ShapeCastHit& hit) {
+    hit = ShapeCastHit();
+    if (object == nullptr) {
+        return false;
+    }
+    object->update();
+    const AABB& bounds = object->getAABB();
+    AABB swept = bounds.merge(AABB(bounds.min + translation, bounds.max + translation));
+    
+    refreshWorldBounds();
+    overlapScratch.resize(objects.size());
+    size_t overlapCount = worldBounds.overlapBatch(swept, 0, objects.size(), overlapScratch.data());
+    for (size_t i = 0; i < overlapCount; ++i) {
+        Object3D* other = objects[overlapScratch[i]];
+        if (other != object && canCollide(object, other)) {
+            castAgainst(object, translation, swept, other, hit);
+        }
+    }
+    
+    if (staticTreeDirty) {
+        rebuildStaticTree();
+    }
+    staticTree.query(swept, [&](int index) {
+        Object3D* other = staticObjects[index];
+        if (other != object && canCollide(object, other)) {
+            castAgainst(object, translation, swept, other, hit);
+        }
+    });
+    return hit.hit();
+}
+
+// 후보 객체 하나에 대해 이동하는 객체의 껍질마다 GJK 광선 투사 (지금까지 찾은 비율보다 먼 결과는 바로 버림)
+// 상대가 분해된 객체면 스윕 AABB를 상대 로컬로 옮겨 껍질 BVH로 겹치는 껍질만 고름
+void CollisionManager::castAgainst(Object3D* object, const Vector3& translation, const AABB& sweptBounds,
+                                   Object3D* other, ShapeCastHit& hit) {
+    const ConvexHull* hullsA = nullptr;
+    const ConvexHull* hullsB = nullptr;
+    size_t countA = 0, countB = 0;
+    collisionHulls(object, hullsA, countA);
+    collisionHulls(other, hullsB, countB);
+    
+    Transform transformA = object->getTransform();
+    Transform transformB = other->getTransform();
+    
+    castHulls.clear();
+    if (usesHullList(other)) {
+        other->getHullTree().query(transformBounds(sweptBounds, transformB.inverse()), castHulls);
+    } else {
+        castHulls.push_back(0);
+    }
+    
+    for (size_t i = 0; i < countA; ++i) {
+        for (int j : castHulls) {
+            Collision::GJKCastResult result;
+            float maxFraction = hit.hit() ? hit.fraction : 1.0f;
+            if (!gjkSolver.Cast(hullsA[i], transformA, hullsB[j], transformB, translation, result, maxFraction) ||
+                (hit.hit() && result.fraction >= hit.fraction)) {
+                continue;
+            }
+            hit.object = other;
+            hit.fraction = result.fraction;
+            hit.distance = result.fraction * translation.magnitude();
+            hit.point = result.pointB;
+            hit.normal = result.normal;
+            hit.hull = j;
+        }
+    }
 }
 
 // EPA 알고리즘 (Expanding Polytope Algorithm)
-bool CollisionManager::epaCalculatePenetration(Object3D* objA, Object3D* objB, 
-                                              const std::vector<Vector3>& polytope,
-                                              CollisionInfo& collisionInfo) {
-    // EPA 알고리즘 구현
-    // 실제 구현에서는 polytope 확장 및 최소 침투 벡터 찾기 필요
-    
-    // 기본 더미 구현 - 실제 구현 필요
-    return false;
+bool CollisionManager::epaCalculatePenetration(const ConvexHull& hullA, const Transform& transformA,
+                                              const ConvexHull& hullB, const Transform& transformB,
+                                              const Collision::Simplex& simplex,
+                                              CollisionInfo& collisionInfo,
+                                              Collision::EPAResult& result) {
+    // 사면체를 만들 수 없는 납작한 접촉이면 믿을 수 있는 깊이/법선이 없으므로 collisionInfo를 건드리지 않고 실패
+    if (!epaSolver.Penetration(hullA, transformA, hullB, transformB, simplex, result)) {
+        return false;
+    }
+    
+    collisionInfo.contactPoint = (result.pointA + result.pointB) * 0.5f;
+    collisionInfo.contactNormal = result.normal;
+    collisionInfo.penetrationDepth = result.depth;
+    return true;
 }
\ No newline at end of file
@@ -1,24 +1,40 @@
 #include "Object3D.h"
+#include "CollisionManager.h"
 #include <fstream>
 #include <sstream>
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <iostream>
 
 // CollisionInfo 구현
 CollisionInfo::CollisionInfo() 
-    : otherObject(nullptr), contactPoint(Vector3()), contactNormal(Vector3()), penetrationDepth(0.0f) {}
+    : otherObject(nullptr), contactPoint(Vector3()), contactNormal(Vector3()), penetrationDepth(0.0f),
+      timeOfImpact(0.0f) {}
 
 CollisionInfo::CollisionInfo(Object3D* other, const Vector3& point, const Vector3& normal, float depth)
-    : otherObject(other), contactPoint(point), contactNormal(normal), penetrationDepth(depth) {}
+    : otherObject(other), contactPoint(point), contactNormal(normal), penetrationDepth(depth),
+      timeOfImpact(0.0f) {}
 
 // Object3D 구현
 Object3D::Object3D(const std::string& _name)
     : name(_name),
+    collisionId(INVALID_ID),
+    bodyType(BodyType::DYNAMIC),
+    manager(nullptr),
+    sleeping(false),
+    movedSinceCheck(true),
+    idleFrames(0),
+    islandIndex(-1),
+    collisionCategory(1u),
+    collisionMask(0xFFFFFFFFu),
     position(Vector3(0, 0, 0)),
     rotation(Quaternion::identity()),
     scale(Vector3(1, 1, 1)),
     transformDirty(true),
+    linearVelocity(Vector3(0, 0, 0)),
+    angularVelocity(Vector3(0, 0, 0)),
+    sweepTime(0.0f),
     aabbDirty(true),
     isInCollision(false),
     isConvexDecomposed(false) {
@@ -26,11 +42,62 @@ Object3D::Object3D(const std::string& _name)
     // 기본 로컬 AABB(원점 중심의 단위 큐브)
     localAABB.min = Vector3(-0.5f, -0.5f, -0.5f);
     localAABB.max = Vector3(0.5f, 0.5f, 0.5f);
+    localOBB = OBB(localAABB);
 
     updateTransformMatrix();
     updateWorldAABB();
 }
 
+// 변환이나 로컬 AABB가 바뀌었음을 표시, 정적 객체면 관리자에 정적 구조 재구축 요청
+void Object3D::markTransformChanged() {
+    transformDirty = true;
+    aabbDirty = true;
+    movedSinceCheck = true;
+    if (manager == nullptr) {
+        return;
+    }
+    manager->markRaycastDirty();
+    if (bodyType == BodyType::STATIC) {
+        manager->markStaticDirty();
+    } else if (sleeping) {
+        manager->wakeObject(this);
+    }
+}
+
+bool Object3D::isSleeping() const {
+    return sleeping;
+}
+
+// 휴면 해제 (관리자에 등록되어 있으면 같은 접촉 섬의 객체도 함께 깨움)
+void Object3D::wakeUp() {
+    if (manager != nullptr) {
+        manager->wakeObject(this);
+    } else {
+        sleeping = false;
+        idleFrames = 0;
+    }
+}
+
+// 강체 종류 설정, 관리자에 등록된 객체면 알맞은 구조로 옮김
+void Object3D::setBodyType(BodyType type) {
+    if (bodyType == type) {
+        return;
+    }
+
+    CollisionManager* owner = manager;
+    if (owner != nullptr) {
+        owner->removeObject(this);
+    }
+    bodyType = type;
+    if (owner != nullptr) {
+        owner->addObject(this);
+    }
+}
+
+BodyType Object3D::getBodyType() const {
+    return bodyType;
+}
+
 // 현재 월드 위치를 반환
 const Vector3& Object3D::getPosition() const {
     return position;
@@ -39,15 +106,13 @@ const Vector3& Object3D::getPosition() const {
 // 객체의 월드 위치를 설정, 변환 행렬 갱신
 void Object3D::setPosition(const Vector3& pos) {
     position = pos;
-    transformDirty = true;
-    aabbDirty = true;
+    markTransformChanged();
 }
 
 // 현재 위치에서 특정 오프셋만큼 이동
 void Object3D::translate(const Vector3& offset) {
     position += offset;
-    transformDirty = true;
-    aabbDirty = true;
+    markTransformChanged();
 }
 
 // 현재 회전 쿼터니언을 반환
@@ -58,15 +123,13 @@ const Quaternion& Object3D::getRotation() const {
 // 객체의 회전을 직접 설정
 void Object3D::setRotation(const Quaternion& rot) {
     rotation = rot;
-    transformDirty = true;
-    aabbDirty = true;
+    markTransformChanged();
 }
 
 // 현재 회전에 추가 회전을 적용(쿼터니언 곱)
 void Object3D::rotate(const Quaternion& rot) {
     rotation = rotation * rot; // 쿼터니언 곱으로 회전 누적
-    transformDirty = true;
-    aabbDirty = true;
+    markTransformChanged();
 }
 
 // 특정 축을 중심으로 회전 적용
@@ -83,15 +146,13 @@ const Vector3& Object3D::getScale() const {
 // X, Y, Z 축별 다른 스케일을 설정 
 void Object3D::setScale(const Vector3& s) {
     scale = s;
-    transformDirty = true;
-    aabbDirty = true;
+    markTransformChanged();
 }
 
 // 모든 축에 동일한 스케일을 설정
 void Object3D::setScale(float uniformScale) {
     scale = Vector3(uniformScale, uniformScale, uniformScale);
-    transformDirty = true;
-    aabbDirty = true;
+    markTransformChanged();
 }
 
 // 변환 행렬을 반환 
@@ -127,7 +188,11 @@ void Object3D::updateTransformMatrix() {
 // 객체의 로컬 AABB설정
 void Object3D::setLocalAABB(const AABB& aabb) {
     localAABB = aabb;
-    aabbDirty = true;
+    // 메시가 없는 객체는 직접 지정한 AABB를 그대로 OBB로 사용
+    if (vertices.empty() && !isConvexDecomposed) {
+        localOBB = OBB(aabb);
+    }
+    markTransformChanged();
 }
 
 // 로컬 AABB 반환
@@ -174,9 +239,160 @@ void Object3D::updateWorldAABB() {
         worldAABB.max.z = std::max(worldAABB.max.z, corners[i].z);
     }
 
+    // 연속 충돌 검사 중이면 sweepTime 동안 지나가는 영역까지 포함
+    if (sweepTime > 0.0f && hasVelocity()) {
+        Vector3 offset = linearVelocity * sweepTime;
+        if (angularVelocity.magnitudeSquared() > 0.0f) {
+            // 회전 중에는 중간 자세의 모서리가 양 끝 AABB를 벗어날 수 있으므로 경계 구를 이동 구간 양 끝에 둠
+            float radius = getBoundingRadius();
+            Vector3 extent(radius, radius, radius);
+            worldAABB = worldAABB.merge(AABB(position - extent, position + extent))
+                                 .merge(AABB(position + offset - extent, position + offset + extent));
+        } else {
+            worldAABB = worldAABB.merge(AABB(worldAABB.min + offset, worldAABB.max + offset));
+        }
+    }
+
     aabbDirty = false;
 }
 
+// 로컬 OBB 반환
+const OBB& Object3D::getLocalOBB() const {
+    return localOBB;
+}
+
+// 로컬 OBB에 변환 적용하여 월드 OBB 계산
+OBB Object3D::getOBB() {
+    return toWorldOBB(localOBB);
+}
+
+// 회전은 축에 그대로 곱하고, 스케일은 OBB 축 좌표계에서 본 스케일 행렬 |Rᵀ S R|로 반 크기를 늘림
+// (비균등 스케일로 기울어진 상자도 감싸며, 균등 스케일이나 축이 맞는 경우에는 정확함)
+OBB Object3D::toWorldOBB(const OBB& local) {
+    if (transformDirty) {
+        updateTransformMatrix();
+    }
+
+    const Matrix3x3& axes = local.orientation;
+    float scaled[3];
+    const float half[3] = { local.halfExtents.x, local.halfExtents.y, local.halfExtents.z };
+    for (int i = 0; i < 3; ++i) {
+        scaled[i] = 0.0f;
+        for (int j = 0; j < 3; ++j) {
+            float m = axes(0, i) * scale.x * axes(0, j) +
+                      axes(1, i) * scale.y * axes(1, j) +
+                      axes(2, i) * scale.z * axes(2, j);
+            scaled[i] += std::abs(m) * half[j];
+        }
+    }
+
+    return OBB(transformPoint(local.center),
+               Vector3(scaled[0], scaled[1], scaled[2]),
+               rotation.toRotationMatrix() * axes);
+}
+
+// 구 충돌 형태 설정
+void Object3D::setSphereShape(float radius, const Vector3& center) {
+    shape = Shape::createSphere(radius, center);
+    applyShape();
+}
+
+// 캡슐 충돌 형태 설정 (axis 방향 선분의 절반 길이 halfHeight)
+void Object3D::setCapsuleShape(float radius, float halfHeight, const Vector3& axis, const Vector3& center) {
+    shape = Shape::createCapsule(radius, halfHeight, axis, center);
+    applyShape();
+}
+
+// 상자 충돌 형태 설정
+void Object3D::setBoxShape(const Vector3& halfExtents, const Vector3& center, const Matrix3x3& orientation) {
+    shape = Shape::createBox(halfExtents, center, orientation);
+    applyShape();
+}
+
+// 메시/껍질 정점을 감싸는 기본 도형으로 설정
+bool Object3D::fitShape(ShapeType type) {
+    if (type == ShapeType::HULL) {
+        setHullShape();
+        return true;
+    }
+
+    std::vector<Vector3> points;
+    std::vector<int> triangles;
+    collectPoints(points, triangles);
+    if (points.empty()) {
+        return false;
+    }
+
+    shape = Shape::fit(type, points, triangles);
+    applyShape();
+    return true;
+}
+
+// 메시/껍질 형태로 되돌리고 로컬 AABB/OBB를 다시 계산
+void Object3D::setHullShape() {
+    shape = Shape();
+    shapeHull = ConvexHull();
+    if (isConvexDecomposed) {
+        buildHullTree();
+    } else if (!vertices.empty()) {
+        AABB meshBounds;
+        meshBounds.computeFromPoints(vertices);
+        setLocalAABB(meshBounds);
+        buildLocalOBB();
+    }
+}
+
+const Shape& Object3D::getShape() const {
+    return shape;
+}
+
+ShapeType Object3D::getShapeType() const {
+    return shape.type;
+}
+
+// 현재 변환을 적용한 기본 도형
+WorldShape Object3D::getWorldShape() {
+    if (transformDirty) {
+        updateTransformMatrix();
+    }
+
+    WorldShape world;
+    world.type = shape.type;
+    float maxScale = std::max(std::abs(scale.x), std::max(std::abs(scale.y), std::abs(scale.z)));
+    switch (shape.type) {
+        case ShapeType::SPHERE:
+            world.center = transformPoint(shape.center);
+            world.radius = shape.radius * maxScale;
+            break;
+        case ShapeType::CAPSULE: {
+            world.center = transformPoint(shape.center);
+            Vector3 halfSegment = transformDirection(shape.axis * shape.halfHeight);
+            float length = halfSegment.magnitude();
+            world.axis = length > 1e-12f ? halfSegment / length : rotation.rotate(shape.axis);
+            world.halfHeight = length;
+            world.radius = shape.radius * maxScale;
+            break;
+        }
+        case ShapeType::BOX:
+            world.box = toWorldOBB(shape.box);
+            world.center = world.box.center;
+            break;
+        default:
+            break;
+    }
+    return world;
+}
+
+const ConvexHull& Object3D::getCollisionHull() const {
+    return shape.isPrimitive() ? shapeHull : meshHull;
+}
+
+void Object3D::applyShape() {
+    shapeHull = shape.buildHull();
+    setLocalAABB(shape.localBounds());
+    localOBB = shape.boundingBox();
+}
+
 // 로컬 좌표를 월드 좌표로 변환
 Vector3 Object3D::transformPoint(const Vector3& point) {
     if (transformDirty) {
@@ -282,6 +498,20 @@ void Object3D::addCollision(const CollisionInfo& collision) {
     }
 }
 
+// 이미 충돌 중인 객체의 충돌 정보 갱신 및 onCollisionStay 콜백 호출
+void Object3D::updateCollision(const CollisionInfo& collision) {
+    for (auto& existing : collisions) {
+        if (existing.otherObject == collision.otherObject) {
+            existing = collision;
+            if (onCollisionStay) {
+                onCollisionStay(collision);
+            }
+            return;
+        }
+    }
+    addCollision(collision);
+}
+
 // 특정 객체와의 충돌 제거 및 콜백 호출
 void Object3D::removeCollision(Object3D* other) {
     auto it = std::find_if(collisions.begin(), collisions.end(),
@@ -314,6 +544,20 @@ void Object3D::clearCollisions() {
     isInCollision = false;
 }
 
+// 충돌 레이어 설정
+void Object3D::setCollisionCategory(uint32_t category) {
+    collisionCategory = category;
+}
+void Object3D::setCollisionMask(uint32_t mask) {
+    collisionMask = mask;
+}
+uint32_t Object3D::getCollisionCategory() const {
+    return collisionCategory;
+}
+uint32_t Object3D::getCollisionMask() const {
+    return collisionMask;
+}
+
 // 충돌 시작 시 호출 콜백 
 void Object3D::setOnCollisionEnter(const CollisionCallback& callback) {
     onCollisionEnter = callback;
@@ -337,12 +581,20 @@ void Object3D::setMeshData(const std::vector<Vector3>& verts,
     normals = norms;
     indices = inds;
     
+    // 분해되지 않은 객체의 GJK 검사에 쓰는 단일 볼록체 (정점만 사용)
+    meshHull.vertices = verts;
+    meshHull.indices.clear();
+    
     // 정점 데이터에서 AABB 자동 계산
     if (!vertices.empty()) {
         AABB meshBounds;
         meshBounds.computeFromPoints(vertices);
         setLocalAABB(meshBounds);
     }
+
+    if (!isConvexDecomposed || shape.isPrimitive()) {
+        buildLocalOBB();
+    }
 }
 
 // OBJ 파일에서 메시 데이터 로드
@@ -413,20 +665,7 @@ bool Object3D::loadConvexDecomposition(const std::string& filepath) {
     // ConvexDecomposition 클래스를 사용하여 분해된 OBJ 파일 로드
     convexHulls = ConvexDecomposition::LoadConvexHulls(filepath);
     isConvexDecomposed = !convexHulls.empty();
-    
-    if (isConvexDecomposed) {
-        // 모든 볼록 껍질의 정점을 합쳐서 전체 AABB 계산
-        std::vector<Vector3> allVertices;
-        for (const auto& hull : convexHulls) {
-            allVertices.insert(allVertices.end(), hull.vertices.begin(), hull.vertices.end());
-        }
-        
-        if (!allVertices.empty()) {
-            AABB combinedBounds;
-            combinedBounds.computeFromPoints(allVertices);
-            setLocalAABB(combinedBounds);
-        }
-    }
+    buildHullTree();
     
     return isConvexDecomposed;
 }
@@ -436,70 +675,201 @@ void Object3D::setConvexHulls(const std::vector<ConvexHull>& hulls) {
     convexHulls = hulls;
     isConvexDecomposed = !convexHulls.empty();
     
-    if (isConvexDecomposed) {
-        // 모든 볼록 껍질의 정점을 합쳐서 전체 AABB 계산
-        std::vector<Vector3> allVertices;
-        for (const auto& hull : convexHulls) {
-            allVertices.insert(allVertices.end(), hull.vertices.begin(), hull.vertices.end());
+    // 언덕 오르기 지원점 탐색용 정점 인접 목록과 SAT용 면/변 (이미 구성된 껍질은 그대로 사용)
+    for (auto& hull : convexHulls) {
+        if (!hull.hasAdjacency()) {
+            hull.buildAdjacency();
+        }
+        if (!hull.hasFeatures()) {
+            hull.buildFeatures();
+        }
+    }
+    
+    buildHullTree();
+}
+
+void Object3D::buildHullTree() {
+    hullBounds.clear();
+    hullTree.clear();
+    if (!isConvexDecomposed) {
+        buildLocalOBB();
+        return;
+    }
+    
+    // 껍질별 로컬 AABB와 그 합 (전체 로컬 AABB)
+    AABB combinedBounds;
+    bool hasVertices = false;
+    hullBounds.reserve(convexHulls.size());
+    for (const auto& hull : convexHulls) {
+        // 정점이 없는 껍질은 원점 한 점 (GJK에서 항상 충돌 없음)
+        AABB bounds(Vector3(0, 0, 0), Vector3(0, 0, 0));
+        if (!hull.vertices.empty()) {
+            bounds.computeFromPoints(hull.vertices);
+            combinedBounds = combinedBounds.merge(bounds);
+            hasVertices = true;
         }
-        
-        if (!allVertices.empty()) {
-            AABB combinedBounds;
-            combinedBounds.computeFromPoints(allVertices);
-            setLocalAABB(combinedBounds);
+        hullBounds.push_back(bounds);
+    }
+    
+    if (hasVertices) {
+        setLocalAABB(combinedBounds);
+    }
+    
+    // 껍질 수가 적으므로 리프 하나에 껍질 하나씩 두어 껍질 쌍을 최대한 걸러냄
+    hullTree.build(hullBounds, 1);
+
+    buildLocalOBB();
+}
+
+void Object3D::buildLocalOBB() {
+    // 기본 도형이면 메시/껍질이 바뀌어도 도형을 감싸는 AABB/OBB를 유지
+    if (shape.isPrimitive()) {
+        applyShape();
+        return;
+    }
+
+    if (!isConvexDecomposed) {
+        localOBB = OBB::fitPoints(vertices, indices);
+        return;
+    }
+
+    // 모든 껍질의 정점과 면을 이어 붙여 한 번에 맞춤 (면 법선은 껍질 면에서 후보를 얻음)
+    std::vector<Vector3> points;
+    std::vector<int> triangles;
+    collectPoints(points, triangles);
+    localOBB = OBB::fitPoints(points, triangles);
+}
+
+// 분해된 객체는 모든 껍질의 정점과 삼각형을 이어 붙이고, 아니면 메시 정점과 삼각형
+void Object3D::collectPoints(std::vector<Vector3>& points, std::vector<int>& triangles) const {
+    if (!isConvexDecomposed) {
+        points = vertices;
+        triangles = indices;
+        return;
+    }
+
+    points.clear();
+    triangles.clear();
+    for (const auto& hull : convexHulls) {
+        int offset = static_cast<int>(points.size());
+        points.insert(points.end(), hull.vertices.begin(), hull.vertices.end());
+        for (int index : hull.indices) {
+            triangles.push_back(index + offset);
         }
     }
 }
 
 // GJK 알고리즘에 사용되는 특정 방향의 최대 지원점 반환
+// 방향을 로컬 공간(S * R^-1 * d)으로 한 번만 바꿔 탐색하고 선택된 정점만 월드로 변환
 Vector3 Object3D::getSupportPoint(const Vector3& direction) const {
+    Vector3 rotatedDir = rotation.inverse().rotate(direction);
+    Vector3 localDir(rotatedDir.x * scale.x, rotatedDir.y * scale.y, rotatedDir.z * scale.z);
+
+    const Vector3* best = nullptr;
     if (isConvexDecomposed) {
-        Vector3 furthestPoint(0, 0, 0);
-        float maxDistance = -std::numeric_limits<float>::max();
-        
         // 모든 볼록 껍질에서 지원점 찾기
+        float maxDistance = -std::numeric_limits<float>::max();
         for (const auto& hull : convexHulls) {
-            // 월드 방향을 로컬 방향으로 변환
-            Vector3 localDir = rotation.inverse().rotate(direction);
-            
-            for (const auto& vertex : hull.vertices) {
-                // 각 정점을 월드 좌표계로 변환
-                Vector3 worldVertex = rotation.rotate(vertex) + position;
-                
-                // 방향에 따른 투영 계산
-                float distance = direction.dot(worldVertex);
-                if (distance > maxDistance) {
-                    maxDistance = distance;
-                    furthestPoint = worldVertex;
-                }
+            int index = hull.supportIndex(localDir);
+            if (index >= 0 && localDir.dot(hull.vertices[index]) > maxDistance) {
+                maxDistance = localDir.dot(hull.vertices[index]);
+                best = &hull.vertices[index];
             }
         }
-        
-        return furthestPoint;
-    } 
-    else {
+    } else {
         // 볼록 분해가 없는 경우, 메시 정점을 직접 사용
-        if (vertices.empty()) {
-            return position; // 정점이 없으면 객체 위치 반환
+        int index = meshHull.supportIndex(localDir);
+        if (index >= 0) {
+            best = &meshHull.vertices[index];
         }
-        
-        Vector3 furthestPoint = position;
-        float maxDistance = -std::numeric_limits<float>::max();
-        
-        for (const auto& vertex : vertices) {
-            // 정점을 월드 좌표계로 변환
-            Vector3 worldVertex = rotation.rotate(vertex) + position;
-            
-            // 방향에 따른 투영 계산
-            float distance = direction.dot(worldVertex);
-            if (distance > maxDistance) {
-                maxDistance = distance;
-                furthestPoint = worldVertex;
-            }
-        }
-        
-        return furthestPoint;
     }
+
+    if (best == nullptr) {
+        return position; // 정점이 없으면 객체 위치 반환
+    }
+
+    Vector3 scaled(best->x * scale.x, best->y * scale.y, best->z * scale.z);
+    return rotation.rotate(scaled) + position;
+}
+
+// 현재 위치/회전/스케일의 변환 (GJK 지원 함수용)
+Transform Object3D::getTransform() {
+    if (transformDirty) {
+        updateTransformMatrix();
+    }
+    return Transform(transformMatrix, position);
+}
+
+// 현재 변환에 time초 동안의 선속도 이동과 각속도 회전을 더한 변환
+Transform Object3D::getTransformAt(float time) {
+    float angularSpeed = angularVelocity.magnitude();
+    if (angularSpeed * time == 0.0f) {
+        Transform transform = getTransform();
+        transform.position = position + linearVelocity * time;
+        return transform;
+    }
+
+    Quaternion spin = Quaternion::fromAxisAngle(angularVelocity / angularSpeed, angularSpeed * time);
+    Matrix3x3 basis = (spin * rotation).normalized().toRotationMatrix();
+    for (int row = 0; row < 3; ++row) {
+        basis(row, 0) *= scale.x;
+        basis(row, 1) *= scale.y;
+        basis(row, 2) *= scale.z;
+    }
+    return Transform(basis, position + linearVelocity * time);
+}
+
+// 로컬 AABB 꼭짓점 중 위치(회전 중심)에서 가장 먼 거리
+float Object3D::getBoundingRadius() const {
+    float radiusSq = 0.0f;
+    for (int i = 0; i < 8; ++i) {
+        Vector3 corner((i & 1) ? localAABB.max.x : localAABB.min.x,
+                       (i & 2) ? localAABB.max.y : localAABB.min.y,
+                       (i & 4) ? localAABB.max.z : localAABB.min.z);
+        Vector3 scaled(corner.x * scale.x, corner.y * scale.y, corner.z * scale.z);
+        radiusSq = std::max(radiusSq, scaled.magnitudeSquared());
+    }
+    return std::sqrt(radiusSq);
+}
+
+// 선속도 설정 (스윕 AABB가 바뀌므로 AABB 갱신 표시)
+void Object3D::setLinearVelocity(const Vector3& velocity) {
+    linearVelocity = velocity;
+    aabbDirty = true;
+    if (manager != nullptr) {
+        manager->markRaycastDirty();
+    }
+    if (sleeping && hasVelocity()) {
+        wakeUp();
+    }
+}
+
+// 각속도 설정 (스윕 AABB가 바뀌므로 AABB 갱신 표시)
+void Object3D::setAngularVelocity(const Vector3& velocity) {
+    angularVelocity = velocity;
+    aabbDirty = true;
+    if (manager != nullptr) {
+        manager->markRaycastDirty();
+    }
+    if (sleeping && hasVelocity()) {
+        wakeUp();
+    }
+}
+
+const Vector3& Object3D::getLinearVelocity() const {
+    return linearVelocity;
+}
+
+const Vector3& Object3D::getAngularVelocity() const {
+    return angularVelocity;
+}
+
+bool Object3D::hasVelocity() const {
+    return linearVelocity.magnitudeSquared() > 0.0f || angularVelocity.magnitudeSquared() > 0.0f;
+}
+
+const ConvexHull& Object3D::getMeshHull() const {
+    return meshHull;
 }
 
 // 내부 접근자
@@ -509,6 +879,12 @@ bool Object3D::isDecomposed() const {
 const std::vector<ConvexHull>& Object3D::getConvexHulls() const { 
     return convexHulls; 
 }
+const std::vector<AABB>& Object3D::getHullBounds() const {
+    return hullBounds;
+}
+const Collision::StaticBVH& Object3D::getHullTree() const {
+    return hullTree;
+}
 const std::vector<Vector3>& Object3D::getVertices() const { 
     return vertices; 
 }
@@ -521,6 +897,9 @@ const std::vector<int>& Object3D::getIndices() const {
 const std::string& Object3D::getName() const {
     return name;
 }
+uint32_t Object3D::getCollisionId() const {
+    return collisionId;
+}
 void Object3D::setName(const std::string& _name) {
     name = _name;
 }
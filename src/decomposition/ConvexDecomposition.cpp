@@ -3,6 +3,10 @@
 #include <sstream>
 #include <iostream>
 #include <cstdlib>
+#include <cstdio>
+#if __cplusplus >= 201703L
+#include <filesystem>
+#endif
 #include "../../vhacd/include/VHACD.h"
 
 // V-HACD 프로세스를 실행하고 결과를 OBJ 파일로 저장
@@ -86,6 +90,12 @@ std::vector<ConvexHull> ConvexDecomposition::LoadConvexHulls(
         convexHulls.push_back(currentHull);
     }
     
+    // 언덕 오르기 지원점 탐색용 정점 인접 목록과 SAT용 면/변
+    for (auto& hull : convexHulls) {
+        hull.buildAdjacency();
+        hull.buildFeatures();
+    }
+    
     return convexHulls;
 }
 
@@ -2,6 +2,7 @@
 #include <cmath>
 #include <algorithm>
 #include <numeric>
+#include <utility>
 
 // 볼록 껍질의 부피 계산 (근사치)
 float ConvexHull::calculateVolume() const {
@@ -90,4 +91,294 @@ Vector3 ConvexHull::support(const Vector3& direction) const {
     }
     
     return furthestPoint;
-}
\ No newline at end of file
+}
+
+// 특정 방향에 최대로 멀리있는 정점의 인덱스
+int ConvexHull::supportIndex(const Vector3& d) const {
+    if (vertices.empty()) {
+        return -1;
+    }
+
+    int best = 0;
+    float maxDot = d.x * vertices[0].x + d.y * vertices[0].y + d.z * vertices[0].z;
+    for (size_t i = 1; i < vertices.size(); ++i) {
+        const Vector3& v = vertices[i];
+        float dot = d.x * v.x + d.y * v.y + d.z * v.z;
+        if (dot > maxDot) {
+            maxDot = dot;
+            best = static_cast<int>(i);
+        }
+    }
+    return best;
+}
+
+// 변환된 껍질의 지원점: d_local = S * R^T * d 로 탐색 후 선택된 정점만 변환
+Vector3 ConvexHull::support(const Vector3& worldDirection, const Transform& transform) const {
+    int index = supportIndex(transform.transposeDirection(worldDirection));
+    if (index < 0) {
+        return transform.position;
+    }
+    return transform.transformPoint(vertices[index]);
+}
+
+// 삼각형 변으로 정점 인접 목록(CSR) 구성
+void ConvexHull::buildAdjacency() {
+    adjacencyStart.clear();
+    adjacency.clear();
+
+    int vertexCount = static_cast<int>(vertices.size());
+    if (vertexCount == 0 || indices.size() < 3) {
+        return;
+    }
+
+    std::vector<std::pair<int, int>> links;
+    links.reserve(indices.size() * 2);
+    for (size_t t = 0; t + 2 < indices.size(); t += 3) {
+        int tri[3] = { indices[t], indices[t + 1], indices[t + 2] };
+        for (int k = 0; k < 3; ++k) {
+            if (tri[k] < 0 || tri[k] >= vertexCount) {
+                return; // 잘못된 인덱스가 있으면 언덕 오르기를 쓰지 않음
+            }
+        }
+        for (int k = 0; k < 3; ++k) {
+            int a = tri[k];
+            int b = tri[(k + 1) % 3];
+            if (a != b) {
+                links.emplace_back(a, b);
+                links.emplace_back(b, a);
+            }
+        }
+    }
+
+    std::sort(links.begin(), links.end());
+    links.erase(std::unique(links.begin(), links.end()), links.end());
+
+    adjacencyStart.assign(vertexCount + 1, 0);
+    for (const auto& edge : links) {
+        adjacencyStart[edge.first + 1]++;
+    }
+    for (int i = 0; i < vertexCount; ++i) {
+        adjacencyStart[i + 1] += adjacencyStart[i];
+    }
+    adjacency.resize(links.size());
+    for (size_t e = 0; e < links.size(); ++e) {
+        adjacency[e] = links[e].second;     // 정렬되어 있으므로 순서대로 채우면 CSR
+    }
+}
+
+namespace {
+
+    // 두 삼각형을 같은 면으로 볼 법선 코사인과 평면 거리 허용값 (껍질 크기 대비)
+    const float COPLANAR_COS = 0.9999f;
+    const float COPLANAR_DISTANCE = 1e-4f;
+
+} // namespace
+
+void ConvexHull::buildFeatures() {
+    faces.clear();
+    faceVertices.clear();
+    edges.clear();
+
+    int vertexCount = static_cast<int>(vertices.size());
+    if (vertexCount < 3 || indices.size() < 3) {
+        return;
+    }
+
+    Vector3 center(0, 0, 0);
+    Vector3 minP = vertices[0], maxP = vertices[0];
+    for (const Vector3& v : vertices) {
+        center += v;
+        minP = Vector3(std::min(minP.x, v.x), std::min(minP.y, v.y), std::min(minP.z, v.z));
+        maxP = Vector3(std::max(maxP.x, v.x), std::max(maxP.y, v.y), std::max(maxP.z, v.z));
+    }
+    center = center / static_cast<float>(vertexCount);
+    float distanceTolerance = COPLANAR_DISTANCE * std::max((maxP - minP).magnitude(), 1e-6f);
+
+    // 삼각형마다 바깥 법선을 구하고 같은 평면의 면에 배정
+    size_t triangleCount = indices.size() / 3;
+    std::vector<int> triangleFace(triangleCount, -1);
+    std::vector<std::vector<int>> faceMembers;
+    for (size_t t = 0; t < triangleCount; ++t) {
+        int tri[3] = { indices[t * 3], indices[t * 3 + 1], indices[t * 3 + 2] };
+        if (tri[0] < 0 || tri[1] < 0 || tri[2] < 0 ||
+            tri[0] >= vertexCount || tri[1] >= vertexCount || tri[2] >= vertexCount) {
+            faces.clear();
+            faceVertices.clear();
+            return;     // 잘못된 인덱스가 있으면 면 정보를 쓰지 않음
+        }
+        Vector3 normal = (vertices[tri[1]] - vertices[tri[0]]).cross(vertices[tri[2]] - vertices[tri[0]]);
+        float length = normal.magnitude();
+        if (length < 1e-12f) {
+            continue;   // 넓이가 없는 삼각형
+        }
+        normal = normal / length;
+        if (normal.dot(vertices[tri[0]] - center) < 0.0f) {
+            normal = -normal;
+        }
+        float offset = normal.dot(vertices[tri[0]]);
+
+        int face = -1;
+        for (size_t f = 0; f < faces.size(); ++f) {
+            if (faces[f].normal.dot(normal) > COPLANAR_COS &&
+                std::abs(faces[f].offset - offset) < distanceTolerance) {
+                face = static_cast<int>(f);
+                break;
+            }
+        }
+        if (face < 0) {
+            face = static_cast<int>(faces.size());
+            HullFace newFace;
+            newFace.normal = normal;
+            newFace.offset = offset;
+            newFace.firstVertex = 0;
+            newFace.vertexCount = 0;
+            faces.push_back(newFace);
+            faceMembers.emplace_back();
+        }
+        triangleFace[t] = face;
+        for (int k = 0; k < 3; ++k) {
+            faceMembers[face].push_back(tri[k]);
+        }
+    }
+
+    // 면 꼭짓점: 면 중심 둘레 각도로 정렬해 법선 기준 반시계 방향 다각형으로 만듦
+    for (size_t f = 0; f < faces.size(); ++f) {
+        std::vector<int>& members = faceMembers[f];
+        std::sort(members.begin(), members.end());
+        members.erase(std::unique(members.begin(), members.end()), members.end());
+
+        const Vector3& normal = faces[f].normal;
+        Vector3 faceCenter(0, 0, 0);
+        for (int index : members) {
+            faceCenter += vertices[index];
+        }
+        faceCenter = faceCenter / static_cast<float>(members.size());
+        Vector3 u = (vertices[members[0]] - faceCenter).normalized();
+        Vector3 w = normal.cross(u);
+
+        std::vector<std::pair<float, int>> ordered;
+        ordered.reserve(members.size());
+        for (int index : members) {
+            Vector3 offset = vertices[index] - faceCenter;
+            ordered.emplace_back(std::atan2(offset.dot(w), offset.dot(u)), index);
+        }
+        std::sort(ordered.begin(), ordered.end());
+
+        faces[f].firstVertex = static_cast<int>(faceVertices.size());
+        faces[f].vertexCount = static_cast<int>(ordered.size());
+        for (const auto& entry : ordered) {
+            faceVertices.push_back(entry.second);
+        }
+    }
+
+    // 변: 삼각형 변을 (작은 정점, 큰 정점)으로 정렬해 짝을 찾고, 서로 다른 면 사이의 변만 남김
+    std::vector<std::pair<std::pair<int, int>, int>> halfEdges;
+    halfEdges.reserve(triangleCount * 3);
+    for (size_t t = 0; t < triangleCount; ++t) {
+        if (triangleFace[t] < 0) {
+            continue;
+        }
+        for (int k = 0; k < 3; ++k) {
+            int a = indices[t * 3 + k];
+            int b = indices[t * 3 + (k + 1) % 3];
+            if (a != b) {
+                halfEdges.push_back(std::make_pair(std::make_pair(std::min(a, b), std::max(a, b)), triangleFace[t]));
+            }
+        }
+    }
+    std::sort(halfEdges.begin(), halfEdges.end());
+    for (size_t i = 0; i + 1 < halfEdges.size(); ++i) {
+        if (halfEdges[i].first != halfEdges[i + 1].first) {
+            continue;
+        }
+        if (halfEdges[i].second != halfEdges[i + 1].second) {
+            HullEdge edge;
+            edge.v0 = halfEdges[i].first.first;
+            edge.v1 = halfEdges[i].first.second;
+            edge.face0 = halfEdges[i].second;
+            edge.face1 = halfEdges[i + 1].second;
+            edges.push_back(edge);
+        }
+        ++i;
+    }
+}
+
+// 언덕 오르기 지원점 탐색 (볼록 다면체에서는 국소 최대가 곧 전역 최대)
+int ConvexHull::supportIndex(const Vector3& d, int startVertex) const {
+    if (!hasAdjacency() || startVertex < 0 || startVertex >= static_cast<int>(vertices.size()) ||
+        adjacencyStart[startVertex] == adjacencyStart[startVertex + 1]) {
+        return supportIndex(d);
+    }
+
+    int current = startVertex;
+    const Vector3& start = vertices[current];
+    float maxDot = d.x * start.x + d.y * start.y + d.z * start.z;
+
+    // 더 먼 이웃이 없을 때까지 가장 먼 이웃으로 이동
+    for (;;) {
+        int next = current;
+        for (int e = adjacencyStart[current]; e < adjacencyStart[current + 1]; ++e) {
+            const Vector3& v = vertices[adjacency[e]];
+            float dot = d.x * v.x + d.y * v.y + d.z * v.z;
+            if (dot > maxDot) {
+                maxDot = dot;
+                next = adjacency[e];
+            }
+        }
+        if (next == current) {
+            return current;
+        }
+        current = next;
+    }
+}
+
+// 캐시된 정점에서 시작하는 변환된 껍질의 지원점
+Vector3 ConvexHull::support(const Vector3& worldDirection, const Transform& transform, int& cachedVertex) const {
+    int index = supportIndex(transform.transposeDirection(worldDirection), cachedVertex);
+    if (index < 0) {
+        return transform.position;
+    }
+    cachedVertex = index;
+    return transform.transformPoint(vertices[index]);
+}
+
+// 면 평면 n·x = offset마다 광선이 바깥에서 안으로 들어가는지(n·d < 0) 나가는지로 구간 [tEnter, tExit]를 좁힘
+bool ConvexHull::raycast(const Vector3& origin, const Vector3& direction, float maxDistance,
+                         float& t, int& face) const {
+    float tEnter = 0.0f;
+    float tExit = maxDistance;
+    int enterFace = -1;
+
+    for (size_t f = 0; f < faces.size(); ++f) {
+        const HullFace& plane = faces[f];
+        float denom = plane.normal.dot(direction);
+        float distance = plane.normal.dot(origin) - plane.offset;
+        if (std::abs(denom) < 1e-12f) {
+            if (distance > 0.0f) {
+                return false;   // 면과 평행하게 바깥을 지나감
+            }
+            continue;
+        }
+
+        float tPlane = -distance / denom;
+        if (denom < 0.0f) {
+            if (tPlane > tEnter) {
+                tEnter = tPlane;
+                enterFace = static_cast<int>(f);
+            }
+        } else if (tPlane < tExit) {
+            tExit = tPlane;
+        }
+        if (tEnter > tExit) {
+            return false;
+        }
+    }
+
+    // 들어가는 면이 없으면 원점이 이미 껍질 안 (시선/선택 광선이 자기 껍질에 막히지 않도록 교차로 보지 않음)
+    if (enterFace < 0) {
+        return false;
+    }
+    t = tEnter;
+    face = enterFace;
+    return true;
+}
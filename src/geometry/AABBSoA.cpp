@@ -0,0 +1,203 @@
+#include "AABBSoA.h"
+#include <algorithm>
+#include <limits>
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define AABB_SOA_SSE
+#include <emmintrin.h>
+#endif
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace {
+
+    // 가장 낮은 1 비트의 위치
+    inline int lowestBit(uint32_t bits) {
+#ifdef _MSC_VER
+        unsigned long index;
+        _BitScanForward(&index, bits);
+        return static_cast<int>(index);
+#else
+        return __builtin_ctz(bits);
+#endif
+    }
+
+    // 비트마스크의 각 1 비트를 base + 위치 인덱스로 기록
+    inline size_t emitMask(uint32_t bits, size_t base, uint32_t* out, size_t n) {
+        while (bits != 0) {
+            out[n++] = static_cast<uint32_t>(base + lowestBit(bits));
+            bits &= bits - 1;
+        }
+        return n;
+    }
+
+} // namespace
+
+void AABBSoA::resize(size_t n) {
+    // 어느 인덱스에서 LANES개를 읽어도 안전하도록 LANES 배수 + LANES 만큼 할당
+    size_t padded = ((n + LANES - 1) / LANES) * LANES + LANES;
+    size_t old = minX.size();
+
+    minX.resize(padded); minY.resize(padded); minZ.resize(padded);
+    maxX.resize(padded); maxY.resize(padded); maxZ.resize(padded);
+
+    // 새로 늘어난 칸과 크기가 줄어 남은 칸을 빈 AABB로 채움
+    size_t from = std::min(n, old);
+    for (size_t i = from; i < padded; ++i) {
+        setEmpty(i);
+    }
+    count = n;
+}
+
+void AABBSoA::setEmpty(size_t i) {
+    const float big = std::numeric_limits<float>::max();
+    minX[i] = big; minY[i] = big; minZ[i] = big;
+    maxX[i] = -big; maxY[i] = -big; maxZ[i] = -big;
+}
+
+size_t AABBSoA::overlapBatch(const AABB& query, size_t begin, size_t end, uint32_t* out) const {
+    size_t n = 0;
+
+#if defined(__AVX__)
+    const __m256 qMinX = _mm256_set1_ps(query.min.x);
+    const __m256 qMinY = _mm256_set1_ps(query.min.y);
+    const __m256 qMinZ = _mm256_set1_ps(query.min.z);
+    const __m256 qMaxX = _mm256_set1_ps(query.max.x);
+    const __m256 qMaxY = _mm256_set1_ps(query.max.y);
+    const __m256 qMaxZ = _mm256_set1_ps(query.max.z);
+
+    for (size_t i = begin; i < end; i += 8) {
+        __m256 x = _mm256_and_ps(_mm256_cmp_ps(_mm256_loadu_ps(&minX[i]), qMaxX, _CMP_LE_OQ),
+                                 _mm256_cmp_ps(_mm256_loadu_ps(&maxX[i]), qMinX, _CMP_GE_OQ));
+        __m256 y = _mm256_and_ps(_mm256_cmp_ps(_mm256_loadu_ps(&minY[i]), qMaxY, _CMP_LE_OQ),
+                                 _mm256_cmp_ps(_mm256_loadu_ps(&maxY[i]), qMinY, _CMP_GE_OQ));
+        __m256 z = _mm256_and_ps(_mm256_cmp_ps(_mm256_loadu_ps(&minZ[i]), qMaxZ, _CMP_LE_OQ),
+                                 _mm256_cmp_ps(_mm256_loadu_ps(&maxZ[i]), qMinZ, _CMP_GE_OQ));
+
+        uint32_t bits = static_cast<uint32_t>(_mm256_movemask_ps(_mm256_and_ps(x, _mm256_and_ps(y, z))));
+        if (end - i < 8) {
+            bits &= (1u << (end - i)) - 1u;
+        }
+        n = emitMask(bits, i, out, n);
+    }
+#elif defined(AABB_SOA_SSE)
+    const __m128 qMinX = _mm_set1_ps(query.min.x);
+    const __m128 qMinY = _mm_set1_ps(query.min.y);
+    const __m128 qMinZ = _mm_set1_ps(query.min.z);
+    const __m128 qMaxX = _mm_set1_ps(query.max.x);
+    const __m128 qMaxY = _mm_set1_ps(query.max.y);
+    const __m128 qMaxZ = _mm_set1_ps(query.max.z);
+
+    for (size_t i = begin; i < end; i += 4) {
+        __m128 x = _mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(&minX[i]), qMaxX),
+                              _mm_cmpge_ps(_mm_loadu_ps(&maxX[i]), qMinX));
+        __m128 y = _mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(&minY[i]), qMaxY),
+                              _mm_cmpge_ps(_mm_loadu_ps(&maxY[i]), qMinY));
+        __m128 z = _mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(&minZ[i]), qMaxZ),
+                              _mm_cmpge_ps(_mm_loadu_ps(&maxZ[i]), qMinZ));
+
+        uint32_t bits = static_cast<uint32_t>(_mm_movemask_ps(_mm_and_ps(x, _mm_and_ps(y, z))));
+        if (end - i < 4) {
+            bits &= (1u << (end - i)) - 1u;
+        }
+        n = emitMask(bits, i, out, n);
+    }
+#else
+    for (size_t i = begin; i < end; ++i) {
+        if (overlaps(i, query)) {
+            out[n++] = static_cast<uint32_t>(i);
+        }
+    }
+#endif
+
+    return n;
+}
+
+size_t AABBSoA::raycastBatch(const RaySlab& ray, float maxDistance, size_t begin, size_t end, uint32_t* out) const {
+    size_t n = 0;
+
+    // 축마다 광선이 먼저 만나는 슬랩 경계 (방향이 음수면 max 쪽)
+    const std::vector<float>& nearX = ray.negative[0] ? maxX : minX;
+    const std::vector<float>& farX = ray.negative[0] ? minX : maxX;
+    const std::vector<float>& nearY = ray.negative[1] ? maxY : minY;
+    const std::vector<float>& farY = ray.negative[1] ? minY : maxY;
+    const std::vector<float>& nearZ = ray.negative[2] ? maxZ : minZ;
+    const std::vector<float>& farZ = ray.negative[2] ? minZ : maxZ;
+
+#if defined(__AVX__)
+    const __m256 originX = _mm256_set1_ps(ray.origin.x);
+    const __m256 originY = _mm256_set1_ps(ray.origin.y);
+    const __m256 originZ = _mm256_set1_ps(ray.origin.z);
+    const __m256 invX = _mm256_set1_ps(ray.invDirection.x);
+    const __m256 invY = _mm256_set1_ps(ray.invDirection.y);
+    const __m256 invZ = _mm256_set1_ps(ray.invDirection.z);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 limit = _mm256_set1_ps(maxDistance);
+
+    for (size_t i = begin; i < end; i += 8) {
+        // max/min은 첫 인자가 NaN이면 두 번째 인자를 돌려주므로 누적값을 두 번째에 둠
+        __m256 tMin = _mm256_max_ps(_mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(&nearX[i]), originX), invX), zero);
+        __m256 tMax = _mm256_min_ps(_mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(&farX[i]), originX), invX), limit);
+        tMin = _mm256_max_ps(_mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(&nearY[i]), originY), invY), tMin);
+        tMax = _mm256_min_ps(_mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(&farY[i]), originY), invY), tMax);
+        tMin = _mm256_max_ps(_mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(&nearZ[i]), originZ), invZ), tMin);
+        tMax = _mm256_min_ps(_mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(&farZ[i]), originZ), invZ), tMax);
+
+        uint32_t bits = static_cast<uint32_t>(_mm256_movemask_ps(_mm256_cmp_ps(tMin, tMax, _CMP_LE_OQ)));
+        if (end - i < 8) {
+            bits &= (1u << (end - i)) - 1u;
+        }
+        n = emitMask(bits, i, out, n);
+    }
+#elif defined(AABB_SOA_SSE)
+    const __m128 originX = _mm_set1_ps(ray.origin.x);
+    const __m128 originY = _mm_set1_ps(ray.origin.y);
+    const __m128 originZ = _mm_set1_ps(ray.origin.z);
+    const __m128 invX = _mm_set1_ps(ray.invDirection.x);
+    const __m128 invY = _mm_set1_ps(ray.invDirection.y);
+    const __m128 invZ = _mm_set1_ps(ray.invDirection.z);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 limit = _mm_set1_ps(maxDistance);
+
+    for (size_t i = begin; i < end; i += 4) {
+        __m128 tMin = _mm_max_ps(_mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(&nearX[i]), originX), invX), zero);
+        __m128 tMax = _mm_min_ps(_mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(&farX[i]), originX), invX), limit);
+        tMin = _mm_max_ps(_mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(&nearY[i]), originY), invY), tMin);
+        tMax = _mm_min_ps(_mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(&farY[i]), originY), invY), tMax);
+        tMin = _mm_max_ps(_mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(&nearZ[i]), originZ), invZ), tMin);
+        tMax = _mm_min_ps(_mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(&farZ[i]), originZ), invZ), tMax);
+
+        uint32_t bits = static_cast<uint32_t>(_mm_movemask_ps(_mm_cmple_ps(tMin, tMax)));
+        if (end - i < 4) {
+            bits &= (1u << (end - i)) - 1u;
+        }
+        n = emitMask(bits, i, out, n);
+    }
+#else
+    for (size_t i = begin; i < end; ++i) {
+        float tMin = std::max(0.0f, (nearX[i] - ray.origin.x) * ray.invDirection.x);
+        float tMax = std::min(maxDistance, (farX[i] - ray.origin.x) * ray.invDirection.x);
+        tMin = std::max(tMin, (nearY[i] - ray.origin.y) * ray.invDirection.y);
+        tMax = std::min(tMax, (farY[i] - ray.origin.y) * ray.invDirection.y);
+        tMin = std::max(tMin, (nearZ[i] - ray.origin.z) * ray.invDirection.z);
+        tMax = std::min(tMax, (farZ[i] - ray.origin.z) * ray.invDirection.z);
+        if (tMin <= tMax) {
+            out[n++] = static_cast<uint32_t>(i);
+        }
+    }
+#endif
+
+    return n;
+}
+
+const char* AABBSoA::simdPath() {
+#if defined(__AVX__)
+    return "AVX";
+#elif defined(AABB_SOA_SSE)
+    return "SSE";
+#else
+    return "scalar";
+#endif
+}
@@ -1,5 +1,7 @@
 #include "geometry/OBB.h"
 #include <cmath>
+#include <algorithm>
+#include <utility>
 
 // getAxis: 회전 행렬의 i번째 열을 반환 (i = 0, 1, 2)
 Vector3 OBB::getAxis(int i) const {
@@ -12,4 +14,325 @@ OBB OBB::fromAABB(const Vector3& min, const Vector3& max) {
     Vector3 halfExtents = (max - min) * 0.5f;
     Matrix3x3 identity; // 기본 생성자가 단위 행렬을 생성한다고 가정
     return OBB(center, halfExtents, identity);
-}
\ No newline at end of file
+}
+
+namespace {
+
+    // 면 법선 후보 좌표계의 최대 개수 (넓은 면부터 사용)
+    const size_t MAX_FACE_CANDIDATES = 64;
+
+    // 거의 같은 방향의 면 법선은 한 번만 시도
+    const float SAME_NORMAL_COS = 0.999f;
+
+    // 대칭 3x3 행렬의 고유 벡터 (순환 Jacobi 회전), 결과는 열 벡터
+    void symmetricEigenvectors(double a[3][3], double v[3][3]) {
+        for (int i = 0; i < 3; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                v[i][j] = (i == j) ? 1.0 : 0.0;
+            }
+        }
+
+        for (int sweep = 0; sweep < 32; ++sweep) {
+            double offDiagonal = a[0][1] * a[0][1] + a[0][2] * a[0][2] + a[1][2] * a[1][2];
+            if (offDiagonal < 1e-20) {
+                break;
+            }
+            for (int p = 0; p < 2; ++p) {
+                for (int q = p + 1; q < 3; ++q) {
+                    if (std::abs(a[p][q]) < 1e-30) {
+                        continue;
+                    }
+                    // a[p][q]를 0으로 만드는 회전
+                    double theta = (a[q][q] - a[p][p]) / (2.0 * a[p][q]);
+                    double t = (theta >= 0.0 ? 1.0 : -1.0) / (std::abs(theta) + std::sqrt(theta * theta + 1.0));
+                    double c = 1.0 / std::sqrt(t * t + 1.0);
+                    double s = t * c;
+                    for (int k = 0; k < 3; ++k) {
+                        double akp = a[k][p], akq = a[k][q];
+                        a[k][p] = c * akp - s * akq;
+                        a[k][q] = s * akp + c * akq;
+                    }
+                    for (int k = 0; k < 3; ++k) {
+                        double apk = a[p][k], aqk = a[q][k];
+                        a[p][k] = c * apk - s * aqk;
+                        a[q][k] = s * apk + c * aqk;
+                    }
+                    for (int k = 0; k < 3; ++k) {
+                        double vkp = v[k][p], vkq = v[k][q];
+                        v[k][p] = c * vkp - s * vkq;
+                        v[k][q] = s * vkp + c * vkq;
+                    }
+                }
+            }
+        }
+    }
+
+    // 정규 직교 축 (x, y, x × y)으로 점 집합을 감싸는 상자, 반환값은 표면적 비교용 값
+    float fitFrame(const std::vector<Vector3>& points, const Vector3& x, const Vector3& y, OBB& box) {
+        Vector3 axes[3] = { x, y, x.cross(y) };
+        float minP[3], maxP[3];
+        for (int k = 0; k < 3; ++k) {
+            minP[k] = maxP[k] = points[0].dot(axes[k]);
+        }
+        for (size_t i = 1; i < points.size(); ++i) {
+            for (int k = 0; k < 3; ++k) {
+                float p = points[i].dot(axes[k]);
+                minP[k] = std::min(minP[k], p);
+                maxP[k] = std::max(maxP[k], p);
+            }
+        }
+
+        Vector3 half((maxP[0] - minP[0]) * 0.5f, (maxP[1] - minP[1]) * 0.5f, (maxP[2] - minP[2]) * 0.5f);
+        box.center = axes[0] * ((maxP[0] + minP[0]) * 0.5f) +
+                     axes[1] * ((maxP[1] + minP[1]) * 0.5f) +
+                     axes[2] * ((maxP[2] + minP[2]) * 0.5f);
+        box.halfExtents = half;
+        box.orientation = Matrix3x3(
+            axes[0].x, axes[1].x, axes[2].x,
+            axes[0].y, axes[1].y, axes[2].y,
+            axes[0].z, axes[1].z, axes[2].z
+        );
+
+        // 부피 대신 표면적으로 비교 (얇은 벽처럼 납작한 메시는 부피가 모두 0에 가까움)
+        return half.x * half.y + half.y * half.z + half.z * half.x;
+    }
+
+} // namespace
+
+// fitPoints: PCA 축과 면 법선 후보 좌표계 중 표면적이 가장 작은 OBB
+OBB OBB::fitPoints(const std::vector<Vector3>& points, const std::vector<int>& triangleIndices) {
+    if (points.empty()) {
+        return OBB(Vector3(0, 0, 0), Vector3(0, 0, 0));
+    }
+
+    // 좌표축 정렬 상자 (AABB와 같음)
+    OBB best;
+    float bestArea = fitFrame(points, Vector3(1, 0, 0), Vector3(0, 1, 0), best);
+
+    // PCA: 점 공분산 행렬의 고유 벡터
+    double mean[3] = { 0.0, 0.0, 0.0 };
+    for (const Vector3& p : points) {
+        mean[0] += p.x;
+        mean[1] += p.y;
+        mean[2] += p.z;
+    }
+    for (double& m : mean) {
+        m /= static_cast<double>(points.size());
+    }
+    double covariance[3][3] = {};
+    for (const Vector3& p : points) {
+        double d[3] = { p.x - mean[0], p.y - mean[1], p.z - mean[2] };
+        for (int i = 0; i < 3; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                covariance[i][j] += d[i] * d[j];
+            }
+        }
+    }
+    double eigenvectors[3][3];
+    symmetricEigenvectors(covariance, eigenvectors);
+    Vector3 pca[3];
+    for (int k = 0; k < 3; ++k) {
+        pca[k] = Vector3(static_cast<float>(eigenvectors[0][k]),
+                         static_cast<float>(eigenvectors[1][k]),
+                         static_cast<float>(eigenvectors[2][k])).normalized();
+    }
+
+    OBB candidate;
+    float area = fitFrame(points, pca[0], (pca[1] - pca[0] * pca[0].dot(pca[1])).normalized(), candidate);
+    if (area < bestArea) {
+        bestArea = area;
+        best = candidate;
+    }
+
+    // 껍질 면 보정: 넓은 면부터 그 법선을 한 축으로 두고, 나머지 축은 법선과 가장 덜 평행한 PCA 축을 직교화해 사용
+    std::vector<std::pair<float, Vector3>> faces;
+    faces.reserve(triangleIndices.size() / 3);
+    for (size_t t = 0; t + 2 < triangleIndices.size(); t += 3) {
+        int i0 = triangleIndices[t], i1 = triangleIndices[t + 1], i2 = triangleIndices[t + 2];
+        int count = static_cast<int>(points.size());
+        if (i0 < 0 || i1 < 0 || i2 < 0 || i0 >= count || i1 >= count || i2 >= count) {
+            continue;
+        }
+        Vector3 normal = (points[i1] - points[i0]).cross(points[i2] - points[i0]);
+        float doubleArea = normal.magnitude();
+        if (doubleArea > 1e-12f) {
+            faces.push_back(std::make_pair(doubleArea, normal / doubleArea));
+        }
+    }
+    size_t faceCount = std::min(faces.size(), MAX_FACE_CANDIDATES);
+    std::partial_sort(faces.begin(), faces.begin() + faceCount, faces.end(),
+                      [](const std::pair<float, Vector3>& a, const std::pair<float, Vector3>& b) {
+                          return a.first > b.first;
+                      });
+
+    std::vector<Vector3> tried;
+    tried.reserve(faceCount);
+    for (size_t f = 0; f < faceCount; ++f) {
+        const Vector3& normal = faces[f].second;
+        bool duplicate = false;
+        for (const Vector3& n : tried) {
+            if (std::abs(n.dot(normal)) > SAME_NORMAL_COS) {
+                duplicate = true;
+                break;
+            }
+        }
+        if (duplicate) {
+            continue;
+        }
+        tried.push_back(normal);
+
+        int k = 0;
+        for (int i = 1; i < 3; ++i) {
+            if (std::abs(pca[i].dot(normal)) < std::abs(pca[k].dot(normal))) {
+                k = i;
+            }
+        }
+        Vector3 tangent = pca[k] - normal * normal.dot(pca[k]);
+        if (tangent.magnitudeSquared() < 1e-12f) {
+            continue;
+        }
+
+        area = fitFrame(points, normal, tangent.normalized(), candidate);
+        if (area < bestArea) {
+            bestArea = area;
+            best = candidate;
+        }
+    }
+
+    return best;
+}
+
+namespace {
+
+    // 평행한 축의 외적이 0에 가까워 생기는 수치 오차를 흡수하기 위해 |R|에 더하는 값
+    const float PARALLEL_EPSILON = 1e-6f;
+
+    // 검사 기준이 되는 OBB의 축(회전 행렬의 열), 중심, 반 크기를 한 번 읽어 둔 것
+    struct OBBFrame {
+        float axis[3][3];   // axis[i] = i번째 축
+        float center[3];
+        float extent[3];
+
+        explicit OBBFrame(const OBB& obb) {
+            for (int i = 0; i < 3; ++i) {
+                axis[i][0] = obb.orientation(0, i);
+                axis[i][1] = obb.orientation(1, i);
+                axis[i][2] = obb.orientation(2, i);
+            }
+            center[0] = obb.center.x;
+            center[1] = obb.center.y;
+            center[2] = obb.center.z;
+            extent[0] = obb.halfExtents.x;
+            extent[1] = obb.halfExtents.y;
+            extent[2] = obb.halfExtents.z;
+        }
+    };
+
+    // Gottschalk의 OBB 분리 축 검사 (Ericson, Real-Time Collision Detection 4.4.1)
+    // B를 A의 좌표계로 옮긴 회전 R = Aᵀ·B와 중심 차 t만으로 15개 축을 닫힌 식으로 검사한다.
+    bool overlapsFrame(const OBBFrame& a, const OBB& obbB) {
+        float bAxis[3][3];
+        for (int j = 0; j < 3; ++j) {
+            bAxis[j][0] = obbB.orientation(0, j);
+            bAxis[j][1] = obbB.orientation(1, j);
+            bAxis[j][2] = obbB.orientation(2, j);
+        }
+        const float eb[3] = { obbB.halfExtents.x, obbB.halfExtents.y, obbB.halfExtents.z };
+        const float* ea = a.extent;
+
+        float R[3][3], AbsR[3][3];
+        for (int i = 0; i < 3; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                R[i][j] = a.axis[i][0] * bAxis[j][0] + a.axis[i][1] * bAxis[j][1] + a.axis[i][2] * bAxis[j][2];
+                AbsR[i][j] = std::abs(R[i][j]) + PARALLEL_EPSILON;
+            }
+        }
+
+        // 중심 차를 A 좌표계로
+        float d[3] = {
+            obbB.center.x - a.center[0],
+            obbB.center.y - a.center[1],
+            obbB.center.z - a.center[2]
+        };
+        float t[3];
+        for (int i = 0; i < 3; ++i) {
+            t[i] = d[0] * a.axis[i][0] + d[1] * a.axis[i][1] + d[2] * a.axis[i][2];
+        }
+
+        float ra, rb;
+
+        // A의 축 A0, A1, A2
+        for (int i = 0; i < 3; ++i) {
+            ra = ea[i];
+            rb = eb[0] * AbsR[i][0] + eb[1] * AbsR[i][1] + eb[2] * AbsR[i][2];
+            if (std::abs(t[i]) > ra + rb) return false;
+        }
+
+        // B의 축 B0, B1, B2
+        for (int j = 0; j < 3; ++j) {
+            ra = ea[0] * AbsR[0][j] + ea[1] * AbsR[1][j] + ea[2] * AbsR[2][j];
+            rb = eb[j];
+            if (std::abs(t[0] * R[0][j] + t[1] * R[1][j] + t[2] * R[2][j]) > ra + rb) return false;
+        }
+
+        // A0 x B0, A0 x B1, A0 x B2
+        ra = ea[1] * AbsR[2][0] + ea[2] * AbsR[1][0];
+        rb = eb[1] * AbsR[0][2] + eb[2] * AbsR[0][1];
+        if (std::abs(t[2] * R[1][0] - t[1] * R[2][0]) > ra + rb) return false;
+
+        ra = ea[1] * AbsR[2][1] + ea[2] * AbsR[1][1];
+        rb = eb[0] * AbsR[0][2] + eb[2] * AbsR[0][0];
+        if (std::abs(t[2] * R[1][1] - t[1] * R[2][1]) > ra + rb) return false;
+
+        ra = ea[1] * AbsR[2][2] + ea[2] * AbsR[1][2];
+        rb = eb[0] * AbsR[0][1] + eb[1] * AbsR[0][0];
+        if (std::abs(t[2] * R[1][2] - t[1] * R[2][2]) > ra + rb) return false;
+
+        // A1 x B0, A1 x B1, A1 x B2
+        ra = ea[0] * AbsR[2][0] + ea[2] * AbsR[0][0];
+        rb = eb[1] * AbsR[1][2] + eb[2] * AbsR[1][1];
+        if (std::abs(t[0] * R[2][0] - t[2] * R[0][0]) > ra + rb) return false;
+
+        ra = ea[0] * AbsR[2][1] + ea[2] * AbsR[0][1];
+        rb = eb[0] * AbsR[1][2] + eb[2] * AbsR[1][0];
+        if (std::abs(t[0] * R[2][1] - t[2] * R[0][1]) > ra + rb) return false;
+
+        ra = ea[0] * AbsR[2][2] + ea[2] * AbsR[0][2];
+        rb = eb[0] * AbsR[1][1] + eb[1] * AbsR[1][0];
+        if (std::abs(t[0] * R[2][2] - t[2] * R[0][2]) > ra + rb) return false;
+
+        // A2 x B0, A2 x B1, A2 x B2
+        ra = ea[0] * AbsR[1][0] + ea[1] * AbsR[0][0];
+        rb = eb[1] * AbsR[2][2] + eb[2] * AbsR[2][1];
+        if (std::abs(t[1] * R[0][0] - t[0] * R[1][0]) > ra + rb) return false;
+
+        ra = ea[0] * AbsR[1][1] + ea[1] * AbsR[0][1];
+        rb = eb[0] * AbsR[2][2] + eb[2] * AbsR[2][0];
+        if (std::abs(t[1] * R[0][1] - t[0] * R[1][1]) > ra + rb) return false;
+
+        ra = ea[0] * AbsR[1][2] + ea[1] * AbsR[0][2];
+        rb = eb[0] * AbsR[2][1] + eb[1] * AbsR[2][0];
+        if (std::abs(t[1] * R[0][2] - t[0] * R[1][2]) > ra + rb) return false;
+
+        // 15개 축 모두에서 겹치면 교차
+        return true;
+    }
+
+} // namespace
+
+// intersects: 닫힌 식 15축 검사, 분리 축을 찾는 즉시 false
+bool OBB::intersects(const OBB& other) const {
+    return overlapsFrame(OBBFrame(*this), other);
+}
+
+// intersectsBatch: 이 OBB의 좌표계를 한 번만 읽어 두고 others 전체와 검사
+size_t OBB::intersectsBatch(const OBB* others, size_t count, uint32_t* out) const {
+    OBBFrame frame(*this);
+    size_t hitCount = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (overlapsFrame(frame, others[i])) {
+            out[hitCount++] = static_cast<uint32_t>(i);
+        }
+    }
+    return hitCount;
+}
@@ -0,0 +1,239 @@
+#include "geometry/Shape.h"
+#include <cmath>
+#include <algorithm>
+
+namespace {
+
+    // 구/캡슐 다면체의 위도 분할 수 (짝수, 적도가 고리 하나가 됨)와 경도 분할 수
+    const int HULL_RINGS = 8;
+    const int HULL_SEGMENTS = 12;
+
+    const float PI = 3.14159265358979f;
+
+    // axis에 수직인 단위 벡터 u, v (axis, u, v가 오른손 좌표계)
+    void perpendicularBasis(const Vector3& axis, Vector3& u, Vector3& v) {
+        float ax = std::abs(axis.x), ay = std::abs(axis.y), az = std::abs(axis.z);
+        Vector3 other = (ax <= ay && ax <= az) ? Vector3(1, 0, 0) : (ay <= az ? Vector3(0, 1, 0) : Vector3(0, 0, 1));
+        u = axis.cross(other).normalized();
+        v = axis.cross(u);
+    }
+
+    // 열이 (axis, u, v)인 회전 행렬
+    Matrix3x3 axisFrame(const Vector3& axis) {
+        Vector3 u, v;
+        perpendicularBasis(axis, u, v);
+        return Matrix3x3(axis.x, u.x, v.x,
+                         axis.y, u.y, v.y,
+                         axis.z, u.z, v.z);
+    }
+
+    // 단위 구 위에 꼭짓점을 둔 위도/경도 다면체의 내접 반지름 (중심에서 면 평면까지의 최소 거리)
+    // 면은 경도 중앙 단면에 대해 대칭이므로 그 단면에서 두 현 중점 (c·sinφ, cosφ)를 잇는 선분까지의 거리로 구한다.
+    float ringInradius() {
+        float c = std::cos(PI / HULL_SEGMENTS);
+        float inradius = c;     // 캡슐 원기둥 면
+        for (int k = 0; k < HULL_RINGS; ++k) {
+            float phi0 = PI * k / HULL_RINGS;
+            float phi1 = PI * (k + 1) / HULL_RINGS;
+            float x0 = c * std::sin(phi0), y0 = std::cos(phi0);
+            float x1 = c * std::sin(phi1), y1 = std::cos(phi1);
+            float length = std::sqrt((x1 - x0) * (x1 - x0) + (y1 - y0) * (y1 - y0));
+            inradius = std::min(inradius, std::abs(x0 * y1 - x1 * y0) / length);
+        }
+        return inradius;
+    }
+
+} // namespace
+
+Shape Shape::createSphere(float radius, const Vector3& center) {
+    Shape shape;
+    shape.type = ShapeType::SPHERE;
+    shape.center = center;
+    shape.radius = std::max(radius, 0.0f);
+    return shape;
+}
+
+Shape Shape::createCapsule(float radius, float halfHeight, const Vector3& axis, const Vector3& center) {
+    Shape shape;
+    shape.type = ShapeType::CAPSULE;
+    shape.center = center;
+    shape.axis = axis.magnitudeSquared() > 1e-12f ? axis.normalized() : Vector3(0, 1, 0);
+    shape.radius = std::max(radius, 0.0f);
+    shape.halfHeight = std::max(halfHeight, 0.0f);
+    return shape;
+}
+
+Shape Shape::createBox(const Vector3& halfExtents, const Vector3& center, const Matrix3x3& orientation) {
+    Shape shape;
+    shape.type = ShapeType::BOX;
+    shape.center = center;
+    shape.box = OBB(center,
+                    Vector3(std::abs(halfExtents.x), std::abs(halfExtents.y), std::abs(halfExtents.z)),
+                    orientation);
+    return shape;
+}
+
+Shape Shape::fit(ShapeType type, const std::vector<Vector3>& points, const std::vector<int>& triangleIndices) {
+    if (points.empty() || type == ShapeType::HULL) {
+        return Shape();
+    }
+
+    OBB bounds = OBB::fitPoints(points, triangleIndices);
+    switch (type) {
+        case ShapeType::BOX:
+            return createBox(bounds.halfExtents, bounds.center, bounds.orientation);
+
+        case ShapeType::SPHERE: {
+            float radiusSq = 0.0f;
+            for (const Vector3& point : points) {
+                radiusSq = std::max(radiusSq, (point - bounds.center).magnitudeSquared());
+            }
+            return createSphere(std::sqrt(radiusSq), bounds.center);
+        }
+
+        case ShapeType::CAPSULE: {
+            // 상자의 가장 긴 축을 선분 방향으로, 축에서 가장 먼 점까지를 반지름으로
+            int longest = 0;
+            const float half[3] = { bounds.halfExtents.x, bounds.halfExtents.y, bounds.halfExtents.z };
+            for (int i = 1; i < 3; ++i) {
+                if (half[i] > half[longest]) {
+                    longest = i;
+                }
+            }
+            Vector3 axis = bounds.getAxis(longest);
+
+            float radiusSq = 0.0f;
+            for (const Vector3& point : points) {
+                Vector3 offset = point - bounds.center;
+                float along = offset.dot(axis);
+                radiusSq = std::max(radiusSq, offset.magnitudeSquared() - along * along);
+            }
+
+            // 선분 끝에서 반구 안에 들어오도록 필요한 만큼만 선분을 늘림
+            float halfHeight = 0.0f;
+            for (const Vector3& point : points) {
+                Vector3 offset = point - bounds.center;
+                float along = std::abs(offset.dot(axis));
+                float radialSq = offset.magnitudeSquared() - along * along;
+                float cap = std::sqrt(std::max(radiusSq - radialSq, 0.0f));
+                halfHeight = std::max(halfHeight, along - cap);
+            }
+            return createCapsule(std::sqrt(radiusSq), halfHeight, axis, bounds.center);
+        }
+
+        default:
+            return Shape();
+    }
+}
+
+AABB Shape::localBounds() const {
+    switch (type) {
+        case ShapeType::SPHERE: {
+            Vector3 extent(radius, radius, radius);
+            return AABB(center - extent, center + extent);
+        }
+        case ShapeType::CAPSULE: {
+            Vector3 extent(radius, radius, radius);
+            Vector3 start = center - axis * halfHeight;
+            Vector3 end = center + axis * halfHeight;
+            return AABB(start - extent, start + extent).merge(AABB(end - extent, end + extent));
+        }
+        case ShapeType::BOX:
+            return box.toAABB();
+        default:
+            return AABB();
+    }
+}
+
+OBB Shape::boundingBox() const {
+    switch (type) {
+        case ShapeType::SPHERE:
+            return OBB(center, Vector3(radius, radius, radius));
+        case ShapeType::CAPSULE:
+            return OBB(center, Vector3(halfHeight + radius, radius, radius), axisFrame(axis));
+        case ShapeType::BOX:
+            return box;
+        default:
+            return OBB();
+    }
+}
+
+ConvexHull Shape::buildHull() const {
+    std::vector<Vector3> vertices;
+    std::vector<int> indices;
+
+    if (type == ShapeType::BOX) {
+        std::array<Vector3, 8> corners = box.getCorners();
+        vertices.assign(corners.begin(), corners.end());
+        indices = {
+            0, 2, 1, 0, 3, 2,   // -z
+            4, 5, 6, 4, 6, 7,   // +z
+            0, 1, 5, 0, 5, 4,   // -y
+            3, 7, 6, 3, 6, 2,   // +y
+            0, 4, 7, 0, 7, 3,   // -x
+            1, 2, 6, 1, 6, 5    // +x
+        };
+    } else if (type == ShapeType::SPHERE || type == ShapeType::CAPSULE) {
+        // 선분 방향을 위로 하는 위도 고리들 (캡슐은 적도 고리를 선분 양 끝에 하나씩)
+        // 꼭짓점을 반지름 / 내접 반지름 비율만큼 밖에 두어 모든 면이 도형에 접하거나 바깥에 있게 함 (외접 다면체)
+        // 내접 다면체는 면 쪽 지원점이 반지름보다 짧아 GJK/EPA/SAT가 접촉을 늦게, 침투를 얕게 보고한다.
+        static const float outerScale = 1.0f / ringInradius();
+        float outerRadius = radius * outerScale;
+        float h = type == ShapeType::CAPSULE ? halfHeight : 0.0f;
+        Vector3 up = type == ShapeType::CAPSULE ? axis : Vector3(0, 1, 0);
+        Vector3 u, v;
+        perpendicularBasis(up, u, v);
+
+        std::vector<float> ringHeights;
+        std::vector<float> ringRadii;
+        for (int k = 1; k < HULL_RINGS; ++k) {
+            float phi = PI * k / HULL_RINGS;
+            float c = std::cos(phi);
+            float s = std::sin(phi);
+            if (2 * k < HULL_RINGS) {
+                ringHeights.push_back(h + outerRadius * c);
+                ringRadii.push_back(outerRadius * s);
+            } else if (2 * k == HULL_RINGS) {
+                ringHeights.push_back(h);
+                ringRadii.push_back(outerRadius);
+                if (h > 0.0f) {
+                    ringHeights.push_back(-h);
+                    ringRadii.push_back(outerRadius);
+                }
+            } else {
+                ringHeights.push_back(-h + outerRadius * c);
+                ringRadii.push_back(outerRadius * s);
+            }
+        }
+
+        int ringCount = static_cast<int>(ringHeights.size());
+        vertices.push_back(center + up * (h + outerRadius));
+        for (int ring = 0; ring < ringCount; ++ring) {
+            for (int j = 0; j < HULL_SEGMENTS; ++j) {
+                float theta = 2.0f * PI * j / HULL_SEGMENTS;
+                vertices.push_back(center + up * ringHeights[ring] +
+                                   (u * std::cos(theta) + v * std::sin(theta)) * ringRadii[ring]);
+            }
+        }
+        vertices.push_back(center - up * (h + outerRadius));
+        int bottom = static_cast<int>(vertices.size()) - 1;
+
+        auto ringVertex = [](int ring, int j) { return 1 + ring * HULL_SEGMENTS + j % HULL_SEGMENTS; };
+        for (int j = 0; j < HULL_SEGMENTS; ++j) {
+            indices.insert(indices.end(), { 0, ringVertex(0, j), ringVertex(0, j + 1) });
+            for (int ring = 0; ring + 1 < ringCount; ++ring) {
+                int a = ringVertex(ring, j), b = ringVertex(ring, j + 1);
+                int c = ringVertex(ring + 1, j + 1), d = ringVertex(ring + 1, j);
+                indices.insert(indices.end(), { a, d, c, a, c, b });
+            }
+            indices.insert(indices.end(), { bottom, ringVertex(ringCount - 1, j + 1), ringVertex(ringCount - 1, j) });
+        }
+    } else {
+        return ConvexHull();
+    }
+
+    ConvexHull hull(vertices, indices);
+    hull.buildAdjacency();
+    hull.buildFeatures();
+    return hull;
+}
@@ -0,0 +1,70 @@
+#include "../../include/math/Transform.h"
+
+Transform::Transform() : basis(Matrix3x3::identity()), position(0, 0, 0) {}
+
+Transform::Transform(const Matrix3x3& basis, const Vector3& position)
+    : basis(basis), position(position) {}
+
+Vector3 Transform::transformPoint(const Vector3& p) const {
+    const auto& m = basis.m;
+    return Vector3(m[0][0] * p.x + m[0][1] * p.y + m[0][2] * p.z + position.x,
+                   m[1][0] * p.x + m[1][1] * p.y + m[1][2] * p.z + position.y,
+                   m[2][0] * p.x + m[2][1] * p.y + m[2][2] * p.z + position.z);
+}
+
+Vector3 Transform::transposeDirection(const Vector3& d) const {
+    const auto& m = basis.m;
+    return Vector3(m[0][0] * d.x + m[1][0] * d.y + m[2][0] * d.z,
+                   m[0][1] * d.x + m[1][1] * d.y + m[2][1] * d.z,
+                   m[0][2] * d.x + m[1][2] * d.y + m[2][2] * d.z);
+}
+
+Matrix3x3 Transform::normalMatrix() const {
+    const auto& m = basis.m;
+    Matrix3x3 cofactor;
+    for (int row = 0; row < 3; ++row) {
+        for (int col = 0; col < 3; ++col) {
+            int r1 = (row + 1) % 3, r2 = (row + 2) % 3;
+            int c1 = (col + 1) % 3, c2 = (col + 2) % 3;
+            cofactor.m[row][col] = m[r1][c1] * m[r2][c2] - m[r1][c2] * m[r2][c1];
+        }
+    }
+    if (basis.determinant() < 0.0f) {
+        cofactor = cofactor * -1.0f;
+    }
+    return cofactor;
+}
+
+Transform Transform::inverse() const {
+    const auto& m = basis.m;
+    float det = basis.determinant();
+    if (det == 0.0f) {
+        return Transform();
+    }
+    float invDet = 1.0f / det;
+
+    Matrix3x3 inv(
+        (m[1][1] * m[2][2] - m[1][2] * m[2][1]) * invDet,
+        (m[0][2] * m[2][1] - m[0][1] * m[2][2]) * invDet,
+        (m[0][1] * m[1][2] - m[0][2] * m[1][1]) * invDet,
+        (m[1][2] * m[2][0] - m[1][0] * m[2][2]) * invDet,
+        (m[0][0] * m[2][2] - m[0][2] * m[2][0]) * invDet,
+        (m[0][2] * m[1][0] - m[0][0] * m[1][2]) * invDet,
+        (m[1][0] * m[2][1] - m[1][1] * m[2][0]) * invDet,
+        (m[0][1] * m[2][0] - m[0][0] * m[2][1]) * invDet,
+        (m[0][0] * m[1][1] - m[0][1] * m[1][0]) * invDet
+    );
+    return Transform(inv, -(inv * position));
+}
+
+Transform Transform::operator*(const Transform& other) const {
+    return Transform(basis * other.basis, transformPoint(other.position));
+}
+
+Transform Transform::identity() {
+    return Transform();
+}
+
+Transform Transform::translation(const Vector3& position) {
+    return Transform(Matrix3x3::identity(), position);
+}
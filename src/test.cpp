@@ -3,10 +3,345 @@
 #include <vector>
 #include "Object3D.h"
 #include "CollisionManager.h"
+#include "AABBSoA.h"
+#include "Ray.h"
+#include "GJK.h"
+#include "Simplex.h"
+#include "ContactManifold.h"
 #include <thread>
 #include <chrono>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+// 축 방향 벡터를 뒤집어 만든 광선(-0 성분 포함)이 슬랩 검사에서 빠지지 않는지 확인
+static bool checkNegatedAxisRays() {
+    AABB box(Vector3(-1, -1, -1), Vector3(1, 1, 1));
+    AABBSoA boxes;
+    boxes.resize(1);
+    boxes.set(0, box);
+
+    const Vector3 axes[3] = { Vector3(1, 0, 0), Vector3(0, 1, 0), Vector3(0, 0, 1) };
+    bool ok = true;
+    for (const Vector3& axis : axes) {
+        for (int sign = 0; sign < 2; ++sign) {
+            Vector3 direction = sign ? -axis : axis;
+            RaySlab ray(-direction * 5.0f, direction);
+
+            float tEntry = 0.0f;
+            uint32_t hits[AABBSoA::LANES];
+            bool slabHit = ray.intersect(box, 100.0f, tEntry);
+            bool batchHit = boxes.raycastBatch(ray, 100.0f, 0, boxes.size(), hits) == 1;
+            if (!slabHit || !batchHit || std::abs(tEntry - 4.0f) > 1e-5f) {
+                std::cerr << "Ray slab check failed for direction " << direction.toString() << std::endl;
+                ok = false;
+            }
+        }
+    }
+    return ok;
+}
+
+// 점 p에서 가장 가까운 삼각형 abc 위의 점 (Ericson, Real-Time Collision Detection 5.1.5)
+static Vector3 closestPointOnTriangle(const Vector3& p, const Vector3& a, const Vector3& b, const Vector3& c) {
+    Vector3 ab = b - a, ac = c - a, ap = p - a;
+    float d1 = ab.dot(ap), d2 = ac.dot(ap);
+    if (d1 <= 0.0f && d2 <= 0.0f) {
+        return a;
+    }
+    Vector3 bp = p - b;
+    float d3 = ab.dot(bp), d4 = ac.dot(bp);
+    if (d3 >= 0.0f && d4 <= d3) {
+        return b;
+    }
+    float vc = d1 * d4 - d3 * d2;
+    if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f) {
+        return a + ab * (d1 / (d1 - d3));
+    }
+    Vector3 cp = p - c;
+    float d5 = ab.dot(cp), d6 = ac.dot(cp);
+    if (d6 >= 0.0f && d5 <= d6) {
+        return c;
+    }
+    float vb = d5 * d2 - d1 * d6;
+    if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f) {
+        return a + ac * (d2 / (d2 - d6));
+    }
+    float va = d3 * d6 - d5 * d4;
+    if (va <= 0.0f && d4 - d3 >= 0.0f && d5 - d6 >= 0.0f) {
+        return b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+    }
+    float denom = 1.0f / (va + vb + vc);
+    return a + ab * (vb * denom) + ac * (vc * denom);
+}
+
+// 꼭짓점 1~4개로 된 단순체에서 원점에 가장 가까운 점 (모든 꼭짓점/변/면을 직접 비교)
+static Vector3 bruteForceSimplexClosest(const std::vector<Vector3>& w) {
+    const Vector3 origin = Vector3::zero();
+    if (w.size() == 1) {
+        return w[0];
+    }
+    if (w.size() == 2) {
+        Vector3 c1, c2;
+        Collision::ManifoldBuilder::ClosestSegmentPoints(w[0], w[1], origin, origin, c1, c2);
+        return c1;
+    }
+    if (w.size() == 3) {
+        return closestPointOnTriangle(origin, w[0], w[1], w[2]);
+    }
+
+    // 사면체: 원점이 네 면 모두에서 반대 꼭짓점 쪽에 있으면 안쪽
+    static const int faces[4][4] = { {0, 1, 2, 3}, {0, 1, 3, 2}, {0, 2, 3, 1}, {1, 2, 3, 0} };
+    bool inside = true;
+    Vector3 best;
+    float bestSq = std::numeric_limits<float>::max();
+    for (const auto& face : faces) {
+        const Vector3& a = w[face[0]];
+        Vector3 normal = (w[face[1]] - a).cross(w[face[2]] - a);
+        if (normal.dot(w[face[3]] - a) * normal.dot(origin - a) < 0.0f) {
+            inside = false;
+        }
+        Vector3 candidate = closestPointOnTriangle(origin, a, w[face[1]], w[face[2]]);
+        if (candidate.magnitudeSquared() < bestSq) {
+            bestSq = candidate.magnitudeSquared();
+            best = candidate;
+        }
+    }
+    return inside ? origin : best;
+}
+
+// 볼록 껍질 정점을 변환한 월드 좌표
+static std::vector<Vector3> worldVertices(const ConvexHull& hull, const Transform& transform,
+                                          const Vector3& offset = Vector3::zero()) {
+    std::vector<Vector3> result;
+    for (const Vector3& vertex : hull.vertices) {
+        result.push_back(transform.transformPoint(vertex) + offset);
+    }
+    return result;
+}
+
+// 떨어진 두 볼록 껍질의 최단 거리: 삼각형 쌍마다 꼭짓점-삼각형, 변-변 거리 중 최솟값
+static float bruteForceDistance(const std::vector<Vector3>& va, const std::vector<int>& ia,
+                                const std::vector<Vector3>& vb, const std::vector<int>& ib) {
+    float bestSq = std::numeric_limits<float>::max();
+    for (size_t s = 0; s + 2 < ia.size(); s += 3) {
+        const Vector3 ta[3] = { va[ia[s]], va[ia[s + 1]], va[ia[s + 2]] };
+        for (size_t t = 0; t + 2 < ib.size(); t += 3) {
+            const Vector3 tb[3] = { vb[ib[t]], vb[ib[t + 1]], vb[ib[t + 2]] };
+            for (int i = 0; i < 3; ++i) {
+                bestSq = std::min(bestSq, (ta[i] - closestPointOnTriangle(ta[i], tb[0], tb[1], tb[2])).magnitudeSquared());
+                bestSq = std::min(bestSq, (tb[i] - closestPointOnTriangle(tb[i], ta[0], ta[1], ta[2])).magnitudeSquared());
+                for (int j = 0; j < 3; ++j) {
+                    Vector3 c1, c2;
+                    Collision::ManifoldBuilder::ClosestSegmentPoints(ta[i], ta[(i + 1) % 3], tb[j], tb[(j + 1) % 3], c1, c2);
+                    bestSq = std::min(bestSq, (c1 - c2).magnitudeSquared());
+                }
+            }
+        }
+    }
+    return std::sqrt(bestSq);
+}
+
+// 두 볼록 껍질이 겹치는지: 모든 삼각형 법선과 변 방향 외적을 축으로 하는 분리 축 검사
+static bool bruteForceOverlap(const std::vector<Vector3>& va, const std::vector<int>& ia,
+                              const std::vector<Vector3>& vb, const std::vector<int>& ib) {
+    std::vector<Vector3> axes;
+    std::vector<Vector3> edgesA, edgesB;
+    for (size_t s = 0; s + 2 < ia.size(); s += 3) {
+        axes.push_back((va[ia[s + 1]] - va[ia[s]]).cross(va[ia[s + 2]] - va[ia[s]]));
+        for (int i = 0; i < 3; ++i) {
+            edgesA.push_back(va[ia[s + (i + 1) % 3]] - va[ia[s + i]]);
+        }
+    }
+    for (size_t t = 0; t + 2 < ib.size(); t += 3) {
+        axes.push_back((vb[ib[t + 1]] - vb[ib[t]]).cross(vb[ib[t + 2]] - vb[ib[t]]));
+        for (int i = 0; i < 3; ++i) {
+            edgesB.push_back(vb[ib[t + (i + 1) % 3]] - vb[ib[t + i]]);
+        }
+    }
+    for (const Vector3& ea : edgesA) {
+        for (const Vector3& eb : edgesB) {
+            axes.push_back(ea.cross(eb));
+        }
+    }
+
+    for (const Vector3& axis : axes) {
+        if (axis.magnitudeSquared() < 1e-12f) {
+            continue;
+        }
+        float minA = std::numeric_limits<float>::max(), maxA = -minA;
+        float minB = minA, maxB = -minA;
+        for (const Vector3& v : va) {
+            minA = std::min(minA, axis.dot(v));
+            maxA = std::max(maxA, axis.dot(v));
+        }
+        for (const Vector3& v : vb) {
+            minB = std::min(minB, axis.dot(v));
+            maxB = std::max(maxB, axis.dot(v));
+        }
+        if (maxA < minB || maxB < minA) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// A를 translation만큼 옮길 때 처음 겹치는 비율 (잘게 나눠 훑은 뒤 이분법, 닿지 않으면 -1)
+static float bruteForceCastFraction(const ConvexHull& hullA, const Transform& transformA,
+                                    const ConvexHull& hullB, const Transform& transformB,
+                                    const Vector3& translation) {
+    std::vector<Vector3> vb = worldVertices(hullB, transformB);
+    auto overlapsAt = [&](float t) {
+        return bruteForceOverlap(worldVertices(hullA, transformA, translation * t), hullA.indices, vb, hullB.indices);
+    };
+
+    const int STEPS = 512;
+    for (int step = 1; step <= STEPS; ++step) {
+        float hi = static_cast<float>(step) / STEPS;
+        if (!overlapsAt(hi)) {
+            continue;
+        }
+        float lo = static_cast<float>(step - 1) / STEPS;
+        for (int i = 0; i < 32; ++i) {
+            float mid = 0.5f * (lo + hi);
+            (overlapsAt(mid) ? hi : lo) = mid;
+        }
+        return 0.5f * (lo + hi);
+    }
+    return -1.0f;
+}
+
+// 회전축/각도, 축별 스케일, 위치로 만든 변환
+static Transform makeTransform(const Vector3& axis, float angle, const Vector3& scale, const Vector3& position) {
+    Matrix3x3 basis = Quaternion::fromAxisAngle(axis.normalized(), angle).toRotationMatrix();
+    for (int row = 0; row < 3; ++row) {
+        basis(row, 0) *= scale.x;
+        basis(row, 1) *= scale.y;
+        basis(row, 2) *= scale.z;
+    }
+    return Transform(basis, position);
+}
+
+// 고정 슬롯 Johnson 단순체, GJK::Distance, GJK::Cast를 고정된 입력에서 직접 계산한 값과 비교
+static bool checkGJKAgainstBruteForce() {
+    bool ok = true;
+
+    // 1. Johnson 부분 알고리즘: 꼭짓점을 모두 넣고 모든 부분 집합 중 가장 가까운 점
+    const std::vector<std::vector<Vector3>> simplices = {
+        { Vector3(1.0f, 0.5f, -0.2f) },
+        { Vector3(-1.0f, 0.3f, 0.2f), Vector3(2.0f, 0.4f, 0.1f) },             // 변 안쪽
+        { Vector3(0.5f, 1.0f, 0.0f), Vector3(2.0f, 3.0f, 0.5f) },              // 꼭짓점
+        { Vector3(-1.0f, -1.0f, 0.7f), Vector3(2.0f, -0.5f, 0.7f), Vector3(0.0f, 2.0f, 0.7f) },  // 면 안쪽
+        { Vector3(0.3f, -1.0f, 0.2f), Vector3(0.5f, 1.0f, 0.1f), Vector3(3.0f, 0.0f, 1.0f) },    // 변
+        { Vector3(1.0f, 0.0f, 0.0f), Vector3(1.0f, 1e-3f, 0.0f), Vector3(1.001f, 0.0f, 1e-3f) }, // 작은 면
+        { Vector3(-1.0f, -1.0f, -1.0f), Vector3(2.0f, -1.0f, -1.0f), Vector3(-1.0f, 2.0f, -1.0f),
+          Vector3(-1.0f, -1.0f, 2.0f) },                                        // 원점을 감쌈
+        { Vector3(0.5f, -1.0f, -1.0f), Vector3(3.0f, -1.0f, -1.0f), Vector3(0.5f, 2.0f, -1.0f),
+          Vector3(0.5f, -1.0f, 2.0f) },                                         // 바깥, 면이 가장 가까움
+        { Vector3(1.0f, 1.0f, 1.0f), Vector3(2.0f, 1.0f, 1.0f), Vector3(1.0f, 2.0f, 1.0f),
+          Vector3(1.0f, 1.0f, 2.0f) },                                          // 바깥, 꼭짓점이 가장 가까움
+    };
+    for (size_t n = 0; n < simplices.size(); ++n) {
+        Collision::Simplex simplex;
+        for (const Vector3& w : simplices[n]) {
+            Collision::SimplexVertex vertex;
+            vertex.w = w;
+            vertex.a = w;
+            vertex.b = Vector3::zero();
+            vertex.indexA = vertex.indexB = 0;
+            simplex.push(vertex);
+        }
+        Vector3 v;
+        Vector3 expected = bruteForceSimplexClosest(simplices[n]);
+        if (!simplex.closestAny(v) || (v - expected).magnitude() > 1e-4f * (1.0f + expected.magnitude())) {
+            std::cerr << "Simplex check failed for case " << n << ": got " << v.toString()
+                      << ", expected " << expected.toString() << std::endl;
+            ok = false;
+        }
+    }
+
+    // 2. 볼록 껍질 쌍 (상자, 사면체, 팔면체를 회전/비균등 스케일해 배치)
+    std::vector<Vector3> boxVertices;
+    for (int i = 0; i < 8; ++i) {
+        boxVertices.push_back(Vector3((i & 1) ? 0.5f : -0.5f, (i & 2) ? 0.5f : -0.5f, (i & 4) ? 0.5f : -0.5f));
+    }
+    ConvexHull box(boxVertices, { 0, 2, 3, 0, 3, 1, 4, 5, 7, 4, 7, 6, 0, 1, 5, 0, 5, 4,
+                                  2, 6, 7, 2, 7, 3, 0, 4, 6, 0, 6, 2, 1, 3, 7, 1, 7, 5 });
+    ConvexHull tetra({ Vector3(0.6f, 0.0f, -0.3f), Vector3(-0.4f, 0.5f, -0.3f), Vector3(-0.4f, -0.5f, -0.3f),
+                       Vector3(0.0f, 0.0f, 0.7f) },
+                     { 0, 1, 2, 0, 1, 3, 1, 2, 3, 2, 0, 3 });
+    ConvexHull octa({ Vector3(0.7f, 0, 0), Vector3(-0.7f, 0, 0), Vector3(0, 0.7f, 0), Vector3(0, -0.7f, 0),
+                      Vector3(0, 0, 0.7f), Vector3(0, 0, -0.7f) },
+                    { 0, 2, 4, 2, 1, 4, 1, 3, 4, 3, 0, 4, 2, 0, 5, 1, 2, 5, 3, 1, 5, 0, 3, 5 });
+    for (ConvexHull* hull : { &box, &tetra, &octa }) {
+        hull->buildAdjacency();
+        hull->buildFeatures();
+    }
+
+    struct HullPairCase {
+        const ConvexHull* hullA;
+        Transform transformA;
+        const ConvexHull* hullB;
+        Transform transformB;
+        Vector3 translation;
+    };
+    const Vector3 one(1.0f, 1.0f, 1.0f);
+    const HullPairCase cases[] = {
+        // 평행한 면끼리 (거리가 면 전체에서 같음)
+        { &box, makeTransform(Vector3(0, 0, 1), 0.0f, one, Vector3::zero()),
+          &box, makeTransform(Vector3(0, 0, 1), 0.0f, one, Vector3(1.5f, 0.2f, -0.1f)), Vector3(2.0f, 0.0f, 0.0f) },
+        // 변-변
+        { &box, makeTransform(Vector3(0, 0, 1), 0.785398f, one, Vector3::zero()),
+          &box, makeTransform(Vector3(1, 0, 0), 0.785398f, one, Vector3(1.9f, 0.1f, 0.05f)), Vector3(2.5f, -0.2f, 0.1f) },
+        // 꼭짓점-면, 비균등 스케일
+        { &tetra, makeTransform(Vector3(1, 1, 0), 0.6f, Vector3(1.0f, 2.0f, 0.5f), Vector3(-0.2f, 0.1f, 0.0f)),
+          &box, makeTransform(Vector3(0, 1, 1), 1.1f, Vector3(1.5f, 1.0f, 0.7f), Vector3(0.3f, 2.4f, 0.2f)),
+          Vector3(0.4f, 3.0f, 0.3f) },
+        { &octa, makeTransform(Vector3(1, 2, 3), 2.0f, one, Vector3(0.0f, 0.0f, -1.8f)),
+          &tetra, makeTransform(Vector3(3, -1, 1), -0.7f, Vector3(1.2f, 1.2f, 1.2f), Vector3(0.2f, -0.1f, 0.4f)),
+          Vector3(-0.3f, 0.2f, 3.5f) },
+        // 멀어지는 이동 (닿지 않음)
+        { &octa, makeTransform(Vector3(0, 1, 0), 0.3f, one, Vector3(-2.0f, 0.0f, 0.0f)),
+          &box, makeTransform(Vector3(1, 0, 1), 0.9f, one, Vector3(0.5f, 0.5f, 0.0f)), Vector3(-3.0f, 0.5f, 0.0f) },
+    };
+
+    Collision::GJK gjk;
+    for (size_t n = 0; n < sizeof(cases) / sizeof(cases[0]); ++n) {
+        const HullPairCase& c = cases[n];
+        std::vector<Vector3> va = worldVertices(*c.hullA, c.transformA);
+        std::vector<Vector3> vb = worldVertices(*c.hullB, c.transformB);
+
+        // 3. 최단 거리 (캐시 없이 한 번, 같은 캐시로 두 번: 세 번째는 웜 스타트)
+        float expected = bruteForceDistance(va, c.hullA->indices, vb, c.hullB->indices);
+        Collision::GJKCache cache;
+        for (int pass = 0; pass < 3; ++pass) {
+            Collision::GJKDistanceResult result;
+            gjk.Distance(*c.hullA, c.transformA, *c.hullB, c.transformB, result, pass == 0 ? nullptr : &cache);
+            float pointGap = (result.pointB - result.pointA).magnitude();
+            if (std::abs(result.distance - expected) > 1e-4f || std::abs(pointGap - expected) > 1e-3f) {
+                std::cerr << "GJK distance check failed for pair " << n << " (pass " << pass << "): got "
+                          << result.distance << ", expected " << expected << std::endl;
+                ok = false;
+            }
+        }
+
+        // 4. 형태 이동 비율
+        float expectedFraction = bruteForceCastFraction(*c.hullA, c.transformA, *c.hullB, c.transformB, c.translation);
+        Collision::GJKCastResult cast;
+        bool hit = gjk.Cast(*c.hullA, c.transformA, *c.hullB, c.transformB, c.translation, cast);
+        if (hit != (expectedFraction >= 0.0f) || (hit && std::abs(cast.fraction - expectedFraction) > 1e-3f)) {
+            std::cerr << "GJK cast check failed for pair " << n << ": got " << (hit ? cast.fraction : -1.0f)
+                      << ", expected " << expectedFraction << std::endl;
+            ok = false;
+        }
+    }
+    return ok;
+}
 
 int main() {
+    if (!checkNegatedAxisRays() || !checkGJKAgainstBruteForce()) {
+        return 1;
+    }
+
     // 1. 두 개의 3D 객체 생성
     Object3D* object1 = new Object3D("Object1");
     Object3D* object2 = new Object3D("Object2");